@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb::bench {
+
+    // 벤치마크용 DB 파일 (.db, .log, .warm, .fsm)을 만들기 전/끝난 뒤에 지움
+    class BenchFiles {
+    public:
+        explicit BenchFiles(std::string db_name) : db_name_(std::move(db_name)) { Remove(); }
+        ~BenchFiles() { Remove(); }
+
+        inline const std::string& get_db_name() const { return db_name_; }
+
+    private:
+        void Remove() {
+            std::filesystem::remove(db_name_);
+            std::filesystem::remove(std::filesystem::path(db_name_).replace_extension(".log"));
+            std::filesystem::remove(std::filesystem::path(db_name_).replace_extension(".warm"));
+            std::filesystem::remove(std::filesystem::path(db_name_).replace_extension(".fsm"));
+        }
+
+        std::string db_name_;
+    };
+
+    // 접근 분포 (벤치마크 인자로 넘기는 값)
+    enum class Distribution : int64_t {
+        UNIFORM = 0,
+        ZIPF = 1,
+    };
+
+    inline const char* DistributionName(int64_t arg) {
+        return static_cast<Distribution>(arg) == Distribution::ZIPF ? "zipf" : "uniform";
+    }
+
+    /**
+     * @brief [0, n) 범위의 키 생성기
+     * ZIPF: 순위 k의 확률이 1/k^theta에 비례 (theta = 0.99면 YCSB 기본값. 상위 몇 %의 키에 접근이 몰림)
+     * 인기 키가 ID 앞쪽에 몰려서 인접 페이지 효과가 생기지 않도록, 순위 -> 키는 곱셈으로 섞음
+     * CDF를 미리 계산하므로 생성은 이진 탐색 한 번 (n이 수백만까지는 부담 없음)
+     */
+    class KeyGenerator {
+    public:
+        KeyGenerator(uint64_t n, Distribution distribution, uint64_t seed = 42, double theta = 0.99)
+            : n_(n), distribution_(distribution), rng_(seed) {
+            if (distribution_ == Distribution::ZIPF) {
+                cdf_.resize(n_);
+                double sum = 0;
+                for (uint64_t k = 0; k < n_; k++) {
+                    sum += 1.0 / std::pow(static_cast<double>(k + 1), theta);
+                    cdf_[k] = sum;
+                }
+                for (auto& c : cdf_) {
+                    c /= sum;
+                }
+            }
+        }
+
+        uint64_t Next() {
+            if (distribution_ == Distribution::UNIFORM) {
+                return std::uniform_int_distribution<uint64_t>(0, n_ - 1)(rng_);
+            }
+            double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+            auto rank = static_cast<uint64_t>(std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin());
+            rank = std::min(rank, n_ - 1);
+            // n과 서로소인 소수를 곱해서 순위를 섞음 (n < 2^32이므로 곱이 넘치지 않고, 순위 -> 키가 일대일)
+            return (rank * 2654435761ULL) % n_;
+        }
+
+    private:
+        uint64_t n_;
+        Distribution distribution_;
+        std::mt19937_64 rng_;
+        std::vector<double> cdf_;
+    };
+
+    // 페이지 num_pages개를 만들어 디스크에 씀 (각 페이지 맨 앞에 자기 page_id 기록)
+    inline void FillPages(BufferPoolManager* bpm, PageId num_pages) {
+        for (PageId i = 0; i < num_pages; i++) {
+            PageId page_id;
+            Page* page = bpm->NewPage(&page_id);
+            std::memcpy(page->get_data(), &page_id, sizeof(page_id));
+            bpm->UnpinPage(page_id, true);
+        }
+        bpm->FlushAllPages();
+    }
+
+    /**
+     * @brief next_page_id_로 연결된 TablePage 체인에 튜플을 계속 추가 (벌크 로드)
+     * @return 첫 페이지 ID
+     */
+    inline PageId BulkLoad(BufferPoolManager* bpm, size_t num_tuples, size_t tuple_size) {
+        std::vector<char> payload(tuple_size, 'x');
+        Tuple tuple(payload.data(), static_cast<uint32_t>(payload.size()));
+
+        PageId first_page_id;
+        auto* page = reinterpret_cast<TablePage*>(bpm->NewPage(&first_page_id));
+        page->Init(first_page_id);
+        PageId page_id = first_page_id;
+
+        for (size_t i = 0; i < num_tuples; i++) {
+            uint16_t slot_id;
+            if (page->InsertTuple(tuple, &slot_id)) {
+                continue;
+            }
+
+            // 꽉 찼으면 다음 페이지를 만들어 연결
+            PageId next_page_id;
+            auto* next = reinterpret_cast<TablePage*>(bpm->NewPage(&next_page_id));
+            next->Init(next_page_id, page_id);
+            page->GetHeader()->next_page_id_ = next_page_id;
+            bpm->UnpinPage(page_id, true);
+
+            page = next;
+            page_id = next_page_id;
+            page->InsertTuple(tuple, &slot_id);
+        }
+        bpm->UnpinPage(page_id, true);
+        return first_page_id;
+    }
+
+    // 실행 연산자 벤치마크용 행 (고정 16바이트)
+    struct Row {
+        int64_t key;
+        int64_t value;
+    };
+
+    /**
+     * @brief make_row(i)로 만든 행 num_rows개를 TablePage 체인으로 적재 (BulkLoad와 같은 방식)
+     * @return 첫 페이지 ID
+     */
+    template <typename MakeRow>
+    PageId LoadRows(BufferPoolManager* bpm, size_t num_rows, MakeRow make_row) {
+        PageId first_page_id;
+        auto* page = reinterpret_cast<TablePage*>(bpm->NewPage(&first_page_id));
+        page->Init(first_page_id);
+        PageId page_id = first_page_id;
+
+        for (size_t i = 0; i < num_rows; i++) {
+            Row row = make_row(i);
+            Tuple tuple(reinterpret_cast<const char*>(&row), sizeof(row));
+            uint16_t slot_id;
+            if (page->InsertTuple(tuple, &slot_id)) {
+                continue;
+            }
+
+            PageId next_page_id;
+            auto* next = reinterpret_cast<TablePage*>(bpm->NewPage(&next_page_id));
+            next->Init(next_page_id, page_id);
+            page->GetHeader()->next_page_id_ = next_page_id;
+            bpm->UnpinPage(page_id, true);
+
+            page = next;
+            page_id = next_page_id;
+            page->InsertTuple(tuple, &slot_id);
+        }
+        bpm->UnpinPage(page_id, true);
+        return first_page_id;
+    }
+}
@@ -0,0 +1,177 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+
+#include "bench_util.hpp"
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kBufferPoolBenchDb = "bench_buffer_pool.db";
+
+        // 멀티스레드 벤치마크에서 모든 스레드가 공유 (첫 스레드가 만들고 정리)
+        std::unique_ptr<bench::BenchFiles> g_files;
+        std::unique_ptr<DiskManager> g_disk_manager;
+        std::unique_ptr<BufferPoolManager> g_bpm;
+        BufferPoolMetricsSnapshot g_start_metrics;
+
+        // 페이지 num_pages개짜리 파일 + pool_size 프레임 버퍼 풀
+        void SetUpPool(size_t pool_size, PageId num_pages) {
+            g_files = std::make_unique<bench::BenchFiles>(kBufferPoolBenchDb);
+            g_disk_manager = std::make_unique<DiskManager>(kBufferPoolBenchDb);
+            g_bpm = std::make_unique<BufferPoolManager>(pool_size, g_disk_manager.get());
+            bench::FillPages(g_bpm.get(), num_pages);
+            g_start_metrics = g_bpm->GetMetricsSnapshot();
+        }
+
+        void TearDownPool(benchmark::State& state) {
+            BufferPoolMetricsSnapshot metrics = g_bpm->GetMetricsSnapshot().Since(g_start_metrics);
+            state.counters["hit_ratio"] = metrics.HitRatio();
+            state.counters["evictions"] = static_cast<double>(metrics.evictions);
+
+            g_bpm.reset();
+            g_disk_manager.reset();
+            g_files.reset();
+        }
+    }
+
+    // 버퍼 풀 생성 + 소멸 시간 vs 풀 크기 (프레임은 mmap만 하고 건드리지 않음)
+    static void BM_BufferPoolConstruct(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+        bench::BenchFiles files(kBufferPoolBenchDb);
+        DiskManager disk_manager(kBufferPoolBenchDb);
+
+        for (auto _ : state) {
+            BufferPoolManager bpm(pool_size, &disk_manager);
+            benchmark::DoNotOptimize(&bpm);
+        }
+        state.counters["pool_mb"] = static_cast<double>(pool_size * PAGE_SIZE) / (1 << 20);
+    }
+    BENCHMARK(BM_BufferPoolConstruct)->RangeMultiplier(8)->Range(1024, 65536)->Unit(benchmark::kMillisecond);
+
+    // 비교용: 예전 방식(new Page[]: 생성자가 프레임 전체를 0으로 채움)
+    static void BM_PageArrayConstruct(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+
+        for (auto _ : state) {
+            auto pages = std::make_unique<Page[]>(pool_size);
+            benchmark::DoNotOptimize(pages.get());
+        }
+        state.counters["pool_mb"] = static_cast<double>(pool_size * PAGE_SIZE) / (1 << 20);
+    }
+    BENCHMARK(BM_PageArrayConstruct)->RangeMultiplier(8)->Range(1024, 65536)->Unit(benchmark::kMillisecond);
+
+    /**
+     * 페이지가 모두 메모리에 있을 때 FetchPage + UnpinPage (hit 경로 = 해시 조회 + 메타데이터 + replacer)
+     * arg0 = 풀 크기. 스레드가 늘면 mutex_ 경합 비용이 드러남
+     */
+    static void BM_FetchPageHit(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+        if (state.thread_index() == 0) {
+            SetUpPool(pool_size, static_cast<PageId>(pool_size));
+        }
+
+        auto page_id = static_cast<PageId>(state.thread_index() % pool_size);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(g_bpm->FetchPage(page_id));
+            g_bpm->UnpinPage(page_id, false);
+            page_id = static_cast<PageId>((page_id + 1) % pool_size);
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0) {
+            TearDownPool(state);
+        }
+    }
+    BENCHMARK(BM_FetchPageHit)->RangeMultiplier(8)->Range(64, 16384)->ThreadRange(1, 8)->UseRealTime();
+
+    /**
+     * 매번 miss: 풀보다 훨씬 큰 파일을 순서대로 읽음 (victim 선택 + ReadPage(page cache) + 체크섬)
+     * arg0 = 풀 크기 (파일은 풀의 16배)
+     */
+    static void BM_FetchPageMiss(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+        const auto num_pages = static_cast<PageId>(pool_size * 16);
+        if (state.thread_index() == 0) {
+            SetUpPool(pool_size, num_pages);
+        }
+
+        PageId page_id = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(g_bpm->FetchPage(page_id));
+            g_bpm->UnpinPage(page_id, false);
+            page_id = (page_id + 1) % num_pages;
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0) {
+            TearDownPool(state);
+        }
+    }
+    BENCHMARK(BM_FetchPageMiss)->Arg(64)->Arg(1024)->UseRealTime();
+
+    /**
+     * 분포에 따른 FetchPage 처리량과 hit 비율
+     * arg0 = 풀 크기 (데이터는 풀의 8배), arg1 = 분포 (0: uniform, 1: zipf)
+     * uniform이면 hit 비율 ~ 1/8, zipf면 핫셋이 풀에 남아서 훨씬 높아야 함
+     */
+    static void BM_FetchPageAccessPattern(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+        const auto num_pages = static_cast<PageId>(pool_size * 8);
+        const auto distribution = static_cast<bench::Distribution>(state.range(1));
+        if (state.thread_index() == 0) {
+            SetUpPool(pool_size, num_pages);
+        }
+
+        bench::KeyGenerator keys(num_pages, distribution, 42 + state.thread_index());
+        for (auto _ : state) {
+            auto page_id = static_cast<PageId>(keys.Next());
+            Page* page = g_bpm->FetchPage(page_id);
+            if (page == nullptr) {
+                continue; // 모든 프레임이 다른 스레드에 pin된 상태 (스레드 수 > 풀 크기일 때만)
+            }
+            benchmark::DoNotOptimize(page->get_data()[0]);
+            g_bpm->UnpinPage(page_id, false);
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetLabel(bench::DistributionName(state.range(1)));
+
+        if (state.thread_index() == 0) {
+            TearDownPool(state);
+        }
+    }
+    BENCHMARK(BM_FetchPageAccessPattern)->ArgsProduct({{256, 4096}, {0, 1}})->ThreadRange(1, 4)->UseRealTime();
+
+    /**
+     * 새 페이지 할당 처리량 (NewPage + UnpinPage)
+     * arg0 = 0: 매번 high-water mark를 늘림 (파일은 extend_pages 단위로만 늘어남)
+     * arg0 = 1: 바로 DeletePage해서 free list에서 재사용
+     */
+    static void BM_NewPage(benchmark::State& state) {
+        const bool recycle = state.range(0) != 0;
+        if (state.thread_index() == 0) {
+            SetUpPool(1024, 0);
+        }
+
+        for (auto _ : state) {
+            PageId page_id;
+            Page* page = g_bpm->NewPage(&page_id);
+            if (page == nullptr) {
+                continue; // 모든 프레임이 다른 스레드에 pin된 상태
+            }
+            g_bpm->UnpinPage(page_id, false);
+            if (recycle) {
+                g_bpm->DeletePage(page_id);
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetLabel(recycle ? "recycle" : "extend");
+
+        if (state.thread_index() == 0) {
+            state.counters["file_pages"] = static_cast<double>(g_disk_manager->GetNumPages());
+            TearDownPool(state);
+        }
+    }
+    BENCHMARK(BM_NewPage)->Arg(0)->Arg(1)->ThreadRange(1, 4)->UseRealTime();
+}
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+
+#include "mydb/recovery/Checkpointer.hpp"
+#include "mydb/recovery/LogRecovery.hpp"
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kCheckpointBenchDb = "bench_checkpoint.db";
+
+        void RemoveBenchFiles() {
+            std::filesystem::remove(kCheckpointBenchDb);
+            std::filesystem::remove(std::filesystem::path(kCheckpointBenchDb).replace_extension(".log"));
+        }
+
+        // 버퍼 풀 전체를 커밋된 트랜잭션의 변경으로 dirty하게 만듦 (페이지당 튜플 8개)
+        void DirtyWholePool(BufferPoolManager* bpm, LogManager* log_manager, size_t pool_size) {
+            char data[200] = {};
+            Transaction txn = log_manager->Begin();
+            for (size_t i = 0; i < pool_size; i++) {
+                PageId page_id;
+                auto* page = reinterpret_cast<TablePage*>(bpm->NewPage(&page_id));
+                page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, &txn, log_manager);
+                for (int j = 0; j < 8; j++) {
+                    uint16_t slot_id;
+                    page->InsertTuple(Tuple(data, sizeof(data)), &slot_id, &txn, log_manager);
+                }
+                bpm->UnpinPage(page_id, true);
+            }
+            log_manager->Commit(&txn);
+        }
+    }
+
+    // 체크포인트 한 번(pool 전체가 dirty인 상태)에 걸리는 시간 vs 풀 크기
+    static void BM_CheckpointDuration(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+
+        for (auto _ : state) {
+            RemoveBenchFiles();
+            DiskManager disk_manager(kCheckpointBenchDb);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(pool_size, &disk_manager, &log_manager);
+            DirtyWholePool(&bpm, &log_manager, pool_size);
+
+            Checkpointer checkpointer(&bpm, &log_manager);
+            CheckpointStats stats = checkpointer.Checkpoint();
+            state.SetIterationTime(static_cast<double>(stats.duration.count()) / 1e6);
+            state.counters["pages_written"] = static_cast<double>(stats.pages_written);
+        }
+        RemoveBenchFiles();
+    }
+    BENCHMARK(BM_CheckpointDuration)->RangeMultiplier(4)->Range(256, 16384)
+        ->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3);
+
+    /**
+     * 크래시 후 재시작(Recover) 시간 vs 풀 크기
+     * arg1 = 0: 체크포인트 없음 (로그 전체 redo)
+     * arg1 = 1: 크래시 직전에 체크포인트 (체크포인트 이후 작업만 redo)
+     */
+    static void BM_RestartTime(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+        const bool with_checkpoint = state.range(1) != 0;
+
+        for (auto _ : state) {
+            RemoveBenchFiles();
+            {
+                DiskManager disk_manager(kCheckpointBenchDb);
+                LogManager log_manager(&disk_manager);
+                BufferPoolManager bpm(pool_size, &disk_manager, &log_manager);
+                DirtyWholePool(&bpm, &log_manager, pool_size);
+
+                if (with_checkpoint) {
+                    Checkpointer checkpointer(&bpm, &log_manager);
+                    checkpointer.Checkpoint();
+                }
+                // 여기서 크래시: 버퍼 풀의 내용은 버려짐
+            }
+
+            DiskManager disk_manager(kCheckpointBenchDb);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(pool_size, &disk_manager, &log_manager);
+            LogRecovery recovery(&disk_manager, &bpm, &log_manager);
+
+            auto start = std::chrono::steady_clock::now();
+            recovery.Recover();
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+            state.SetIterationTime(elapsed.count());
+            state.counters["redone_records"] = static_cast<double>(recovery.get_num_redone_records());
+        }
+        RemoveBenchFiles();
+    }
+    BENCHMARK(BM_RestartTime)->ArgsProduct({{256, 1024, 4096, 16384}, {0, 1}})
+        ->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3);
+}
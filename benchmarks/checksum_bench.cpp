@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <random>
+
+#include "mydb/common/Crc32c.hpp"
+#include "mydb/storage/DiskManager.hpp"
+
+namespace mydb {
+
+    namespace {
+        Page MakeRandomPage() {
+            Page page;
+            std::mt19937 rng(42);
+            for (size_t i = 0; i < PAGE_SIZE; i++) {
+                page.get_data()[i] = static_cast<char>(rng());
+            }
+            return page;
+        }
+    }
+
+    // 페이지 하나(16KB) 체크섬 계산 비용: ns/page = 출력의 Time 항목
+    static void BM_PageChecksumHardware(benchmark::State& state) {
+        if (!Crc32cHardwareAvailable()) {
+            state.SkipWithError("SSE4.2 not supported");
+            return;
+        }
+        Page page = MakeRandomPage();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Crc32cHardware(page.get_data(), PAGE_CHECKSUM_OFFSET));
+        }
+        state.SetBytesProcessed(state.iterations() * PAGE_SIZE);
+    }
+    BENCHMARK(BM_PageChecksumHardware);
+
+    static void BM_PageChecksumPortable(benchmark::State& state) {
+        Page page = MakeRandomPage();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Crc32cPortable(page.get_data(), PAGE_CHECKSUM_OFFSET));
+        }
+        state.SetBytesProcessed(state.iterations() * PAGE_SIZE);
+    }
+    BENCHMARK(BM_PageChecksumPortable);
+
+    // 실제 ReadPage 경로(page cache hit 상태)에서 검증 포함 비용
+    static void BM_DiskManagerReadPage(benchmark::State& state) {
+        const std::string db_name = "bench_checksum.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            Page page = MakeRandomPage();
+            const PageId num_pages = 64;
+            for (PageId i = 0; i < num_pages; i++) {
+                disk_manager.AllocatePage();
+                disk_manager.WritePage(i, page);
+            }
+
+            PageId page_id = 0;
+            for (auto _ : state) {
+                disk_manager.ReadPage(page_id, page);
+                page_id = (page_id + 1) % num_pages;
+            }
+            state.SetBytesProcessed(state.iterations() * PAGE_SIZE);
+        }
+        std::filesystem::remove(db_name);
+    }
+    BENCHMARK(BM_DiskManagerReadPage);
+}
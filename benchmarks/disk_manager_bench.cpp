@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <random>
+
+#include "bench_util.hpp"
+#include "mydb/storage/DiskManager.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kDiskBenchDb = "bench_disk.db";
+    }
+
+    /**
+     * 페이지 쓰기 처리량 (체크섬 계산 + pwritev, fsync 없음)
+     * arg0 = 파일 크기(페이지 수), arg1 = 0: 순차, 1: 임의 위치
+     */
+    static void BM_DiskManagerWritePage(benchmark::State& state) {
+        const auto num_pages = static_cast<PageId>(state.range(0));
+        const bool random = state.range(1) != 0;
+        bench::BenchFiles files(kDiskBenchDb);
+        DiskManager disk_manager(kDiskBenchDb);
+        for (PageId i = 0; i < num_pages; i++) {
+            disk_manager.AllocatePage();
+        }
+
+        Page page;
+        std::memset(page.get_data(), 'x', PAGE_TRAILER_OFFSET);
+        bench::KeyGenerator keys(num_pages, bench::Distribution::UNIFORM);
+        PageId page_id = 0;
+
+        for (auto _ : state) {
+            disk_manager.WritePage(page_id, page);
+            page_id = random ? static_cast<PageId>(keys.Next()) : (page_id + 1) % num_pages;
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * PAGE_SIZE);
+        state.SetLabel(random ? "random" : "sequential");
+    }
+    BENCHMARK(BM_DiskManagerWritePage)->ArgsProduct({{1024, 16384}, {0, 1}});
+
+    /**
+     * 페이지 읽기 처리량 (page cache hit 상태. 읽기 + 체크섬 검증)
+     * arg0 = 파일 크기(페이지 수), arg1 = 0: 순차, 1: 임의 위치
+     */
+    static void BM_DiskManagerReadPages(benchmark::State& state) {
+        const auto num_pages = static_cast<PageId>(state.range(0));
+        const bool random = state.range(1) != 0;
+        bench::BenchFiles files(kDiskBenchDb);
+        DiskManager disk_manager(kDiskBenchDb);
+
+        Page page;
+        std::memset(page.get_data(), 'x', PAGE_TRAILER_OFFSET);
+        for (PageId i = 0; i < num_pages; i++) {
+            disk_manager.AllocatePage();
+            disk_manager.WritePage(i, page);
+        }
+
+        bench::KeyGenerator keys(num_pages, bench::Distribution::UNIFORM);
+        PageId page_id = 0;
+        for (auto _ : state) {
+            disk_manager.ReadPage(page_id, page);
+            page_id = random ? static_cast<PageId>(keys.Next()) : (page_id + 1) % num_pages;
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * PAGE_SIZE);
+        state.SetLabel(random ? "random" : "sequential");
+    }
+    BENCHMARK(BM_DiskManagerReadPages)->ArgsProduct({{1024, 16384}, {0, 1}});
+
+    namespace {
+        // 데이터 파일 arg개짜리 테이블스페이스 (DB 파일 + 추가 파일)
+        TablespaceOptions MultiFileOptions(int64_t num_files) {
+            TablespaceOptions options;
+            for (int64_t i = 1; i < num_files; i++) {
+                options.extra_files.push_back(kDiskBenchDb + "." + std::to_string(i));
+            }
+            options.segment_pages = 256; // 4MB
+            return options;
+        }
+
+        void RemoveExtraFiles(const TablespaceOptions& options) {
+            for (const auto& file : options.extra_files) {
+                std::filesystem::remove(file);
+            }
+            std::filesystem::remove(std::filesystem::path(kDiskBenchDb).replace_extension(".tbs"));
+        }
+
+        std::unique_ptr<DiskManager> g_tablespace_disk;
+    }
+
+    /**
+     * 여러 스레드의 임의 페이지 읽기 (page cache hit 상태, 16384페이지 = 256MB)
+     * arg0 = 데이터 파일 수. 파일마다 fd가 따로라 스레드끼리 락을 공유하지 않음
+     * (실제 디바이스를 나눠 두면 파일별 I/O 큐가 동시에 처리됨. 여기서는 page cache라 락 경합 제거 효과만 보임)
+     */
+    static void BM_TablespaceParallelRead(benchmark::State& state) {
+        constexpr PageId kNumPages = 16384;
+        TablespaceOptions options = MultiFileOptions(state.range(0));
+
+        if (state.thread_index() == 0) {
+            RemoveExtraFiles(options);
+            std::filesystem::remove(kDiskBenchDb);
+            g_tablespace_disk = std::make_unique<DiskManager>(kDiskBenchDb, options);
+
+            Page page;
+            std::memset(page.get_data(), 'x', PAGE_TRAILER_OFFSET);
+            for (PageId i = 0; i < kNumPages; i++) {
+                g_tablespace_disk->AllocatePage();
+                g_tablespace_disk->WritePage(i, page);
+            }
+        }
+
+        Page page;
+        bench::KeyGenerator keys(kNumPages, bench::Distribution::UNIFORM, 42 + state.thread_index());
+        for (auto _ : state) {
+            g_tablespace_disk->ReadPage(static_cast<PageId>(keys.Next()), page);
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * PAGE_SIZE);
+
+        if (state.thread_index() == 0) {
+            g_tablespace_disk.reset();
+            RemoveExtraFiles(options);
+            std::filesystem::remove(kDiskBenchDb);
+        }
+    }
+    BENCHMARK(BM_TablespaceParallelRead)->Arg(1)->Arg(4)->ThreadRange(1, 4)->UseRealTime();
+}
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+
+#include "bench_util.hpp"
+#include "mydb/execution/ExternalSort.hpp"
+#include "mydb/execution/ParallelScan.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kSortBenchDb = "bench_external_sort.db";
+
+        // 풀 256 프레임(4MB). 정렬 메모리도 풀과 같은 4MB로 두고, 입력을 풀의 1~10배로 늘림
+        constexpr size_t kSortPoolSize = 256;
+        constexpr size_t kSortMemoryLimit = kSortPoolSize * PAGE_SIZE;
+
+        // 16바이트 행이 꽉 찬 페이지 기준 행 수
+        constexpr size_t kRowsPerPage = PAGE_TRAILER_OFFSET / (sizeof(bench::Row) + sizeof(Slot));
+
+        struct SortBenchDb {
+            bench::BenchFiles files{kSortBenchDb};
+            DiskManager disk_manager{kSortBenchDb};
+            BufferPoolManager bpm{kSortPoolSize, &disk_manager};
+            std::vector<PageId> pages;
+
+            // 풀 크기의 multiple배 페이지를 무작위 키로 채움
+            size_t Load(size_t multiple) {
+                size_t num_rows = multiple * kSortPoolSize * kRowsPerPage;
+                pages = ParallelScan::CollectPages(&bpm, bench::LoadRows(&bpm, num_rows, [](size_t i) {
+                    return bench::Row{static_cast<int64_t>(i * 0x9E3779B97F4A7C15ULL), static_cast<int64_t>(i)};
+                }));
+                return num_rows;
+            }
+        };
+    }
+
+    /**
+     * ORDER BY key. items = 입력 행 수
+     * arg0 = 입력 크기 (풀 크기의 배수), arg1 = 0: 프리페치 없음, 1: 다음 run 페이지 프리페치
+     */
+    static void BM_ExternalSort(benchmark::State& state) {
+        const auto multiple = static_cast<size_t>(state.range(0));
+        SortBenchDb db;
+        size_t num_rows = db.Load(multiple);
+
+        ExternalSortOptions options;
+        options.memory_limit = kSortMemoryLimit;
+        options.prefetch = state.range(1) != 0;
+        ExternalSort sort(&db.bpm, options);
+        ExternalSortStats stats;
+        for (auto _ : state) {
+            int64_t checksum = 0;
+            stats = sort.Execute(db.pages, SortColumns{}, [&](const char*, const char* payload) {
+                int64_t value;
+                std::memcpy(&value, payload, sizeof(value));
+                checksum += value;
+            });
+            benchmark::DoNotOptimize(checksum);
+        }
+        state.SetItemsProcessed(state.iterations() * num_rows);
+        state.counters["data/pool"] = static_cast<double>(db.pages.size()) / kSortPoolSize;
+        state.counters["runs"] = static_cast<double>(stats.runs);
+        state.counters["spilled_pages"] = static_cast<double>(stats.spilled_pages);
+        state.counters["prefetch_waits"] = static_cast<double>(stats.prefetch_waits);
+    }
+    BENCHMARK(BM_ExternalSort)->ArgsProduct({{1, 2, 5, 10}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+    // 기준: 같은 스캔으로 모든 행을 메모리 한 배열에 모아 std::sort (메모리 제한 없음)
+    static void BM_InMemorySort(benchmark::State& state) {
+        const auto multiple = static_cast<size_t>(state.range(0));
+        SortBenchDb db;
+        size_t num_rows = db.Load(multiple);
+
+        for (auto _ : state) {
+            std::vector<bench::Row> rows;
+            rows.reserve(num_rows);
+            for (PageId page_id : db.pages) {
+                auto* page = reinterpret_cast<TablePage*>(db.bpm.FetchPage(page_id));
+                const Slot* slots = page->GetSlotArray();
+                for (uint16_t i = 0; i < page->GetHeader()->num_slots_; i++) {
+                    bench::Row row;
+                    std::memcpy(&row, page->get_data() + slots[i].offset_, sizeof(row));
+                    rows.push_back(row);
+                }
+                db.bpm.UnpinPage(page_id, false);
+            }
+            std::sort(rows.begin(), rows.end(), [](const bench::Row& a, const bench::Row& b) { return a.key < b.key; });
+            benchmark::DoNotOptimize(rows.data());
+        }
+        state.SetItemsProcessed(state.iterations() * num_rows);
+    }
+    BENCHMARK(BM_InMemorySort)->Arg(1)->Arg(2)->Arg(5)->Arg(10)->Unit(benchmark::kMillisecond);
+}
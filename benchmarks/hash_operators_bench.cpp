@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <unordered_map>
+
+#include "bench_util.hpp"
+#include "mydb/execution/HashOperators.hpp"
+#include "mydb/execution/ParallelScan.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kHashBenchDb = "bench_hash_operators.db";
+
+        // 풀 1024 프레임(16MB). 4M 행(약 80MB)이면 입력이 풀의 5배 정도
+        constexpr size_t kHashPoolSize = 1024;
+
+        struct HashBenchDb {
+            bench::BenchFiles files{kHashBenchDb};
+            DiskManager disk_manager{kHashBenchDb};
+            BufferPoolManager bpm{kHashPoolSize, &disk_manager};
+
+            template <typename MakeRow>
+            std::vector<PageId> Load(size_t num_rows, MakeRow make_row) {
+                return ParallelScan::CollectPages(&bpm, bench::LoadRows(&bpm, num_rows, make_row));
+            }
+        };
+
+        // 키를 섞어서 같은 그룹이 연속으로 오지 않게
+        inline int64_t ScatterKey(size_t i, size_t num_keys) {
+            return static_cast<int64_t>((i * 2654435761ULL) % num_keys);
+        }
+    }
+
+    /**
+     * GROUP BY key, COUNT/SUM/MIN/MAX(value). items = 입력 행 수
+     * arg0 = 입력 행 수, arg1 = 그룹 수
+     */
+    static void BM_HashAggregate(benchmark::State& state) {
+        const auto num_rows = static_cast<size_t>(state.range(0));
+        const auto num_groups = static_cast<size_t>(state.range(1));
+        HashBenchDb db;
+        std::vector<PageId> pages = db.Load(num_rows, [&](size_t i) {
+            return bench::Row{ScatterKey(i, num_groups), static_cast<int64_t>(i)};
+        });
+
+        HashAggregate aggregate(&db.bpm);
+        HashOperatorStats stats;
+        for (auto _ : state) {
+            int64_t checksum = 0;
+            stats = aggregate.Execute(pages, KeyValueColumns{}, [&](const AggregateRow& row) {
+                checksum += row.sum;
+            });
+            benchmark::DoNotOptimize(checksum);
+        }
+        state.SetItemsProcessed(state.iterations() * num_rows);
+        state.counters["partitions"] = static_cast<double>(stats.partitions);
+        state.counters["groups"] = static_cast<double>(stats.output_rows);
+    }
+    BENCHMARK(BM_HashAggregate)->ArgsProduct({{100'000, 1'000'000, 4'000'000}, {1024, 1 << 20}})
+        ->Unit(benchmark::kMillisecond);
+
+    // 기준: 같은 스캔 + std::unordered_map 하나에 집계 (노드 기반, 파티셔닝 없음)
+    static void BM_UnorderedMapAggregate(benchmark::State& state) {
+        const auto num_rows = static_cast<size_t>(state.range(0));
+        const auto num_groups = static_cast<size_t>(state.range(1));
+        HashBenchDb db;
+        std::vector<PageId> pages = db.Load(num_rows, [&](size_t i) {
+            return bench::Row{ScatterKey(i, num_groups), static_cast<int64_t>(i)};
+        });
+
+        for (auto _ : state) {
+            std::unordered_map<int64_t, AggregateRow> groups;
+            for (PageId page_id : pages) {
+                auto* page = reinterpret_cast<TablePage*>(db.bpm.FetchPage(page_id));
+                const Slot* slots = page->GetSlotArray();
+                for (uint16_t i = 0; i < page->GetHeader()->num_slots_; i++) {
+                    bench::Row row;
+                    std::memcpy(&row, page->get_data() + slots[i].offset_, sizeof(row));
+                    auto [it, inserted] = groups.try_emplace(row.key, AggregateRow{row.key, 0, 0, row.value, row.value});
+                    it->second.count++;
+                    it->second.sum += row.value;
+                    it->second.min = std::min(it->second.min, row.value);
+                    it->second.max = std::max(it->second.max, row.value);
+                }
+                db.bpm.UnpinPage(page_id, false);
+            }
+            benchmark::DoNotOptimize(groups.size());
+        }
+        state.SetItemsProcessed(state.iterations() * num_rows);
+    }
+    BENCHMARK(BM_UnorderedMapAggregate)->ArgsProduct({{100'000, 1'000'000, 4'000'000}, {1024, 1 << 20}})
+        ->Unit(benchmark::kMillisecond);
+
+    /**
+     * 메모리 한도에 따른 spill 비용 (1M 행, 1M 그룹)
+     * arg0 = memory_limit (MB)
+     */
+    static void BM_HashAggregateSpill(benchmark::State& state) {
+        constexpr size_t kRows = 1'000'000;
+        HashBenchDb db;
+        std::vector<PageId> pages = db.Load(kRows, [](size_t i) {
+            return bench::Row{ScatterKey(i, kRows), static_cast<int64_t>(i)};
+        });
+
+        HashOperatorOptions options;
+        options.memory_limit = static_cast<size_t>(state.range(0)) * 1024 * 1024;
+        HashAggregate aggregate(&db.bpm, options);
+        HashOperatorStats stats;
+        for (auto _ : state) {
+            stats = aggregate.Execute(pages, KeyValueColumns{}, [](const AggregateRow& row) {
+                benchmark::DoNotOptimize(row.sum);
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * kRows);
+        state.counters["spilled_pages"] = static_cast<double>(stats.spilled_pages);
+    }
+    BENCHMARK(BM_HashAggregateSpill)->Arg(64)->Arg(4)->Arg(1)->Unit(benchmark::kMillisecond);
+
+    /**
+     * build(probe의 1/8, 키 중복 없음) x probe(키의 절반만 매칭). items = build + probe 행 수
+     * arg0 = probe 행 수
+     */
+    static void BM_HashJoin(benchmark::State& state) {
+        const auto probe_rows = static_cast<size_t>(state.range(0));
+        const size_t build_rows = probe_rows / 8;
+        HashBenchDb db;
+        std::vector<PageId> build_pages = db.Load(build_rows, [](size_t i) {
+            return bench::Row{static_cast<int64_t>(i), static_cast<int64_t>(i)};
+        });
+        std::vector<PageId> probe_pages = db.Load(probe_rows, [&](size_t i) {
+            return bench::Row{ScatterKey(i, build_rows * 2), static_cast<int64_t>(i)};
+        });
+
+        HashJoin join(&db.bpm);
+        HashOperatorStats stats;
+        for (auto _ : state) {
+            int64_t checksum = 0;
+            stats = join.Execute(build_pages, KeyValueColumns{}, probe_pages, KeyValueColumns{},
+                                 [&](int64_t, int64_t build_value, int64_t probe_value) {
+                                     checksum += build_value ^ probe_value;
+                                 });
+            benchmark::DoNotOptimize(checksum);
+        }
+        state.SetItemsProcessed(state.iterations() * (build_rows + probe_rows));
+        state.counters["partitions"] = static_cast<double>(stats.partitions);
+        state.counters["matches"] = static_cast<double>(stats.output_rows);
+    }
+    BENCHMARK(BM_HashJoin)->Arg(100'000)->Arg(1'000'000)->Arg(4'000'000)->Unit(benchmark::kMillisecond);
+}
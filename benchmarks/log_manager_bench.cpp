@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+
+#include "mydb/recovery/LogManager.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kLogBenchDb = "bench_wal.db";
+
+        // 모든 벤치마크 스레드가 같은 LogManager를 공유 (첫 스레드가 만들고, 마지막에 정리)
+        std::unique_ptr<DiskManager> g_disk_manager;
+        std::unique_ptr<LogManager> g_log_manager;
+
+        void SetUpLog() {
+            std::filesystem::remove(kLogBenchDb);
+            std::filesystem::remove(std::filesystem::path(kLogBenchDb).replace_extension(".log"));
+            g_disk_manager = std::make_unique<DiskManager>(kLogBenchDb);
+            g_log_manager = std::make_unique<LogManager>(g_disk_manager.get());
+        }
+
+        void TearDownLog() {
+            g_log_manager.reset();
+            g_disk_manager.reset();
+            std::filesystem::remove(kLogBenchDb);
+            std::filesystem::remove(std::filesystem::path(kLogBenchDb).replace_extension(".log"));
+        }
+    }
+
+    /**
+     * 트랜잭션 1개 = BEGIN + INSERT(tuple_size) + COMMIT(영속화 대기)
+     * Time = 커밋 지연시간, items_per_second = 전체 커밋 처리량
+     * 스레드가 늘수록 한 번의 fdatasync에 여러 커밋이 묶여서(group commit) 처리량이 늘어야 함
+     */
+    static void BM_LogCommit(benchmark::State& state) {
+        if (state.thread_index() == 0) {
+            SetUpLog();
+        }
+
+        std::vector<char> payload(state.range(0), 'x');
+        Tuple tuple(payload.data(), static_cast<uint32_t>(payload.size()));
+
+        for (auto _ : state) {
+            Transaction txn = g_log_manager->Begin();
+            LogRecord record = LogRecord::MakeInsert(0, 0, tuple);
+            g_log_manager->AppendLogRecord(&record, &txn);
+            g_log_manager->Commit(&txn);
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0) {
+            TearDownLog();
+        }
+    }
+    BENCHMARK(BM_LogCommit)->Arg(100)->ThreadRange(1, 16)->UseRealTime();
+
+    // 커밋 대기 없이 Append만 (로그 버퍼 경합 비용)
+    static void BM_LogAppend(benchmark::State& state) {
+        if (state.thread_index() == 0) {
+            SetUpLog();
+        }
+
+        std::vector<char> payload(state.range(0), 'x');
+        Tuple tuple(payload.data(), static_cast<uint32_t>(payload.size()));
+        Transaction txn(static_cast<TxnId>(state.thread_index() + 1));
+
+        for (auto _ : state) {
+            LogRecord record = LogRecord::MakeInsert(0, 0, tuple);
+            g_log_manager->AppendLogRecord(&record, &txn);
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * (LogRecord::HEADER_SIZE + state.range(0)));
+
+        if (state.thread_index() == 0) {
+            TearDownLog();
+        }
+    }
+    BENCHMARK(BM_LogAppend)->Arg(100)->ThreadRange(1, 16)->UseRealTime();
+}
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "mydb/buffer/ClockReplacer.hpp"
+#include "mydb/buffer/LRUReplacer.hpp"
+
+namespace mydb {
+
+    /**
+     * Unpin으로 가득 채운 뒤 Victim으로 하나씩 꺼냄 (프레임 하나당 Unpin + Victim 한 번)
+     * arg0 = 프레임 수
+     */
+    static void BM_LRUReplacerUnpinVictim(benchmark::State& state) {
+        const auto num_frames = static_cast<FrameId>(state.range(0));
+        LRUReplacer replacer(num_frames);
+
+        for (auto _ : state) {
+            for (FrameId i = 0; i < num_frames; i++) {
+                replacer.Unpin(i);
+            }
+            FrameId victim;
+            while (replacer.Victim(&victim)) {
+                benchmark::DoNotOptimize(victim);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * num_frames);
+    }
+    BENCHMARK(BM_LRUReplacerUnpinVictim)->RangeMultiplier(16)->Range(64, 65536);
+
+    /**
+     * 버퍼 풀 hit 경로와 같은 패턴: 이미 관리 중인 프레임을 Pin했다가 다시 Unpin (리스트 중간 삭제 + 뒤에 추가)
+     * arg0 = 프레임 수
+     */
+    static void BM_LRUReplacerPinUnpin(benchmark::State& state) {
+        const auto num_frames = static_cast<FrameId>(state.range(0));
+        LRUReplacer replacer(num_frames);
+        for (FrameId i = 0; i < num_frames; i++) {
+            replacer.Unpin(i);
+        }
+
+        FrameId frame_id = 0;
+        for (auto _ : state) {
+            replacer.Pin(frame_id);
+            replacer.Unpin(frame_id);
+            frame_id = (frame_id * 7 + 1) % num_frames;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_LRUReplacerPinUnpin)->RangeMultiplier(16)->Range(64, 65536);
+
+    // CLOCK 비교용: 같은 패턴에서 victim 탐색은 바늘이 최대 두 바퀴
+    static void BM_ClockReplacerUnpinVictim(benchmark::State& state) {
+        const auto num_frames = static_cast<FrameId>(state.range(0));
+        ClockReplacer replacer(num_frames);
+
+        for (auto _ : state) {
+            for (FrameId i = 0; i < num_frames; i++) {
+                replacer.Unpin(i);
+            }
+            FrameId victim;
+            while (replacer.Victim(&victim)) {
+                benchmark::DoNotOptimize(victim);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * num_frames);
+    }
+    BENCHMARK(BM_ClockReplacerUnpinVictim)->RangeMultiplier(16)->Range(64, 65536);
+
+    // CLOCK 비교용: hit 경로의 Pin/Unpin이 배열 접근 한 번
+    static void BM_ClockReplacerPinUnpin(benchmark::State& state) {
+        const auto num_frames = static_cast<FrameId>(state.range(0));
+        ClockReplacer replacer(num_frames);
+        for (FrameId i = 0; i < num_frames; i++) {
+            replacer.Unpin(i);
+        }
+
+        FrameId frame_id = 0;
+        for (auto _ : state) {
+            replacer.Pin(frame_id);
+            replacer.Unpin(frame_id);
+            frame_id = (frame_id * 7 + 1) % num_frames;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ClockReplacerPinUnpin)->RangeMultiplier(16)->Range(64, 65536);
+}
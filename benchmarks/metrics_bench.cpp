@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include "mydb/common/Metrics.hpp"
+
+namespace mydb {
+
+    // 여러 스레드가 같은 카운터를 증가시킬 때 (샤드 덕분에 스레드 수가 늘어도 비용이 거의 같아야 함)
+    static void BM_ShardedCounterAdd(benchmark::State& state) {
+        static ShardedCounter counter;
+        for (auto _ : state) {
+            counter.Add();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ShardedCounterAdd)->ThreadRange(1, 16);
+
+    // 비교용: 샤드 없는 atomic 카운터 하나
+    static void BM_SharedAtomicAdd(benchmark::State& state) {
+        static std::atomic<uint64_t> counter{0};
+        for (auto _ : state) {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_SharedAtomicAdd)->ThreadRange(1, 16);
+
+    static void BM_HistogramRecord(benchmark::State& state) {
+        static LatencyHistogram histogram;
+        uint64_t value = 1;
+        for (auto _ : state) {
+            histogram.Record(value);
+            value = value * 7 + 13;
+            value &= (1ULL << 30) - 1;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_HistogramRecord)->ThreadRange(1, 16);
+
+    // 지연시간 측정 한 번의 비용 (clock 두 번 + Record)
+    static void BM_ScopedLatencyTimer(benchmark::State& state) {
+        static LatencyHistogram histogram;
+        for (auto _ : state) {
+            ScopedLatencyTimer timer(histogram);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ScopedLatencyTimer);
+}
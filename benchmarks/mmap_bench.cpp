@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <random>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kMmapBenchDb = "bench_mmap.db";
+
+        // 데이터셋 파일을 num_pages 크기로 준비 (같은 크기면 재사용)
+        void PrepareDataset(PageId num_pages) {
+            if (std::filesystem::exists(kMmapBenchDb) &&
+                std::filesystem::file_size(kMmapBenchDb) == static_cast<uintmax_t>(num_pages) * PAGE_SIZE) {
+                return;
+            }
+            std::filesystem::remove(kMmapBenchDb);
+
+            DiskManager disk_manager(kMmapBenchDb);
+            BufferPoolManager bpm(64, &disk_manager);
+            for (PageId i = 0; i < num_pages; i++) {
+                PageId page_id;
+                Page* page = bpm.NewPage(&page_id);
+                std::memcpy(page->get_data(), &page_id, sizeof(page_id));
+                bpm.UnpinPage(page_id, true);
+            }
+            bpm.FlushAllPages();
+        }
+
+        // mmap 모드는 DB 파일을 읽기 전용으로 열어야 함
+        TablespaceOptions DiskOptions(bool use_mmap) {
+            TablespaceOptions options;
+            options.read_only = use_mmap;
+            return options;
+        }
+
+        // 버퍼 모드의 풀 크기 = 데이터셋의 1/8 (데이터셋이 풀보다 훨씬 큰 상황)
+        std::unique_ptr<BufferPoolManager> MakePool(DiskManager* disk_manager, PageId num_pages, bool use_mmap,
+                                                    AccessPattern pattern) {
+            BufferPoolOptions options;
+            options.mmap_read_only = use_mmap;
+            options.mmap_access_pattern = pattern;
+            return std::make_unique<BufferPoolManager>(num_pages / 8, disk_manager, nullptr, options);
+        }
+    }
+
+    /**
+     * 임의 페이지 점 조회: FetchPage + 페이지 내용 읽기 + UnpinPage
+     * arg0 = 데이터셋 페이지 수, arg1 = 0: 버퍼 모드(pread 복사), 1: 읽기 전용 mmap 모드
+     */
+    static void BM_ReadOnlyRandomLookup(benchmark::State& state) {
+        const auto num_pages = static_cast<PageId>(state.range(0));
+        const bool use_mmap = state.range(1) != 0;
+        PrepareDataset(num_pages);
+
+        DiskManager disk_manager(kMmapBenchDb, DiskOptions(use_mmap));
+        auto bpm = MakePool(&disk_manager, num_pages, use_mmap, AccessPattern::RANDOM);
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<PageId> dist(0, num_pages - 1);
+        uint64_t sum = 0;
+
+        for (auto _ : state) {
+            PageId page_id = dist(rng);
+            Page* page = bpm->FetchPage(page_id);
+            sum += *reinterpret_cast<const uint32_t*>(page->get_data());
+            bpm->UnpinPage(page_id, false);
+        }
+        benchmark::DoNotOptimize(sum);
+        state.SetItemsProcessed(state.iterations());
+        state.SetLabel(use_mmap ? "mmap" : "buffered");
+    }
+    BENCHMARK(BM_ReadOnlyRandomLookup)->ArgsProduct({{4096, 32768}, {0, 1}});
+
+    // 풀 스캔: 모든 페이지를 순서대로 읽고 페이지마다 전체 내용을 훑음 (mmap 모드는 SEQUENTIAL 힌트)
+    static void BM_ReadOnlySequentialScan(benchmark::State& state) {
+        const auto num_pages = static_cast<PageId>(state.range(0));
+        const bool use_mmap = state.range(1) != 0;
+        PrepareDataset(num_pages);
+
+        DiskManager disk_manager(kMmapBenchDb, DiskOptions(use_mmap));
+        auto bpm = MakePool(&disk_manager, num_pages, use_mmap, AccessPattern::SEQUENTIAL);
+        uint64_t sum = 0;
+
+        for (auto _ : state) {
+            for (PageId page_id = 0; page_id < num_pages; page_id++) {
+                Page* page = bpm->FetchPage(page_id);
+                const auto* words = reinterpret_cast<const uint64_t*>(page->get_data());
+                for (size_t i = 0; i < PAGE_SIZE / sizeof(uint64_t); i += 8) {
+                    sum += words[i];
+                }
+                bpm->UnpinPage(page_id, false);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(num_pages) * PAGE_SIZE);
+        state.SetLabel(use_mmap ? "mmap" : "buffered");
+    }
+    BENCHMARK(BM_ReadOnlySequentialScan)->ArgsProduct({{4096, 32768}, {0, 1}})->Unit(benchmark::kMillisecond);
+}
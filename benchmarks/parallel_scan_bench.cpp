@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+
+#include "bench_util.hpp"
+#include "mydb/execution/ParallelScan.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kParallelScanBenchDb = "bench_parallel_scan.db";
+
+        // 약 1M 행 (16바이트) = 1200여 페이지. 풀(2048)에 전부 올라가 있는 warm 상태로 측정
+        constexpr size_t kScanRows = 1'000'000;
+        constexpr size_t kScanPoolSize = 2048;
+
+        struct ScanTable {
+            bench::BenchFiles files{kParallelScanBenchDb};
+            DiskManager disk_manager{kParallelScanBenchDb};
+            BufferPoolManager bpm{kScanPoolSize, &disk_manager};
+            PageId first_page_id = INVALID_PAGE_ID;
+            std::vector<PageId> pages;
+
+            ScanTable() {
+                first_page_id = bench::LoadRows(&bpm, kScanRows, [](size_t i) {
+                    return bench::Row{static_cast<int64_t>(i % 1000), static_cast<int64_t>(i)};
+                });
+                pages = ParallelScan::CollectPages(&bpm, first_page_id);
+            }
+        };
+
+        struct ScanAgg {
+            int64_t count = 0;
+            int64_t sum = 0;
+        };
+
+        // SELECT COUNT(*), SUM(value) WHERE key < 100 (선택도 10%)
+        inline void FilterAggregate(ScanAgg& agg, const TablePage* page) {
+            const Slot* slots = page->GetSlotArray();
+            uint16_t num_slots = page->GetHeader()->num_slots_;
+            for (uint16_t i = 0; i < num_slots; i++) {
+                bench::Row row;
+                std::memcpy(&row, page->get_data() + slots[i].offset_, sizeof(row));
+                if (row.key < 100) {
+                    agg.count++;
+                    agg.sum += row.value;
+                }
+            }
+        }
+    }
+
+    // 기준: 한 스레드가 next_page_id_ 체인을 따라가며 같은 필터 + 집계
+    static void BM_SerialChainScan(benchmark::State& state) {
+        ScanTable table;
+        for (auto _ : state) {
+            ScanAgg agg;
+            PageId page_id = table.first_page_id;
+            while (page_id != INVALID_PAGE_ID) {
+                auto* page = reinterpret_cast<TablePage*>(table.bpm.FetchPage(page_id));
+                FilterAggregate(agg, page);
+                PageId next_page_id = page->GetHeader()->next_page_id_;
+                table.bpm.UnpinPage(page_id, false);
+                page_id = next_page_id;
+            }
+            benchmark::DoNotOptimize(agg);
+        }
+        state.SetItemsProcessed(state.iterations() * kScanRows);
+    }
+    BENCHMARK(BM_SerialChainScan)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+    /**
+     * morsel 병렬 스캔 (필터 + 워커별 집계 + 병합)
+     * arg0 = 워커 수, arg1 = morsel 크기 (페이지)
+     */
+    static void BM_ParallelScan(benchmark::State& state) {
+        ScanTable table;
+        ParallelScanOptions options;
+        options.num_threads = static_cast<size_t>(state.range(0));
+        options.morsel_pages = static_cast<PageId>(state.range(1));
+        ParallelScan scan(&table.bpm, table.pages, options);
+
+        ParallelScanStats stats;
+        size_t stolen = 0;
+        for (auto _ : state) {
+            ScanAgg agg = scan.Aggregate<ScanAgg>(FilterAggregate, [](ScanAgg& result, const ScanAgg& local) {
+                result.count += local.count;
+                result.sum += local.sum;
+            }, &stats);
+            benchmark::DoNotOptimize(agg);
+            stolen += stats.stolen_morsels;
+        }
+        state.SetItemsProcessed(state.iterations() * kScanRows);
+        state.counters["morsels"] = static_cast<double>(stats.morsels);
+        state.counters["stolen_per_scan"] = static_cast<double>(stolen) / static_cast<double>(state.iterations());
+    }
+    BENCHMARK(BM_ParallelScan)->ArgsProduct({{1, 2, 4, 8}, {16}})->Args({4, 1})->Args({4, 64})
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+}
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    /**
+     * 페이지 하나에 튜플 삽입 (꽉 차면 Init으로 비우고 계속). items = 삽입한 튜플 수
+     * arg0 = 튜플 크기 (byte)
+     */
+    static void BM_TablePageInsert(benchmark::State& state) {
+        const auto tuple_size = static_cast<uint32_t>(state.range(0));
+        std::vector<char> payload(tuple_size, 'x');
+        Tuple tuple(payload.data(), tuple_size);
+
+        TablePage page;
+        page.Init(0);
+        for (auto _ : state) {
+            uint16_t slot_id;
+            if (!page.InsertTuple(tuple, &slot_id)) {
+                page.Init(0);
+                page.InsertTuple(tuple, &slot_id);
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * tuple_size);
+    }
+    BENCHMARK(BM_TablePageInsert)->RangeMultiplier(4)->Range(16, 4096);
+
+    /**
+     * 꽉 찬 페이지에서 슬롯을 돌아가며 GetTuple (복사 포함)
+     * arg0 = 튜플 크기 (byte)
+     */
+    static void BM_TablePageGetTuple(benchmark::State& state) {
+        const auto tuple_size = static_cast<uint32_t>(state.range(0));
+        std::vector<char> payload(tuple_size, 'x');
+
+        TablePage page;
+        page.Init(0);
+        uint16_t slot_id;
+        uint16_t num_tuples = 0;
+        while (page.InsertTuple(Tuple(payload.data(), tuple_size), &slot_id)) {
+            num_tuples++;
+        }
+
+        uint16_t slot = 0;
+        Tuple tuple;
+        for (auto _ : state) {
+            page.GetTuple(slot, &tuple);
+            benchmark::DoNotOptimize(tuple.GetData());
+            slot = static_cast<uint16_t>((slot + 1) % num_tuples);
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * tuple_size);
+    }
+    BENCHMARK(BM_TablePageGetTuple)->RangeMultiplier(4)->Range(16, 4096);
+}
@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "mydb/storage/TablePage.hpp"
+
+// 행마다 malloc이 몇 번 일어나는지 세기 위해 전역 operator new를 바꿈 (mydb_bench 전체에 적용. 카운터 증가 하나만 추가됨)
+namespace {
+    thread_local uint64_t t_num_allocations = 0;
+}
+
+void* operator new(size_t size) {
+    t_num_allocations++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+// 위 operator new가 malloc을 쓰므로 free로 해제 (GCC는 new/free 짝이 안 맞는다고 경고함)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+#pragma GCC diagnostic pop
+
+namespace mydb {
+
+    namespace {
+        // 튜플 저장 방식 (벤치마크 인자로 넘기는 값)
+        enum class TupleStorage : int64_t {
+            FRESH = 0, // 행마다 새 Tuple (힙 또는 inline)
+            ARENA = 1, // 쿼리 하나당 TupleArena, 끝나면 Reset
+        };
+
+        const char* StorageName(int64_t arg) {
+            return static_cast<TupleStorage>(arg) == TupleStorage::ARENA ? "arena" : "fresh";
+        }
+
+        // 튜플 크기 tuple_size로 꽉 채운 페이지
+        uint16_t FillPage(TablePage* page, uint32_t tuple_size) {
+            std::vector<char> payload(tuple_size, 'x');
+            page->Init(0);
+            uint16_t slot_id;
+            uint16_t num_tuples = 0;
+            while (page->InsertTuple(Tuple(payload.data(), tuple_size), &slot_id)) {
+                num_tuples++;
+            }
+            return num_tuples;
+        }
+    }
+
+    /**
+     * 페이지 하나를 스캔해서 모든 행을 결과(vector<Tuple>)로 모음 = 쿼리 하나. items = 행 수
+     * arg0 = 튜플 크기 (INLINE_SIZE 이하면 두 방식 모두 할당 없음), arg1 = 저장 방식
+     */
+    static void BM_TupleScanMaterialize(benchmark::State& state) {
+        const auto tuple_size = static_cast<uint32_t>(state.range(0));
+        const auto storage = static_cast<TupleStorage>(state.range(1));
+
+        TablePage page;
+        uint16_t num_tuples = FillPage(&page, tuple_size);
+
+        TupleArena arena;
+        std::vector<Tuple> rows;
+        rows.reserve(num_tuples);
+
+        uint64_t allocations = t_num_allocations;
+        for (auto _ : state) {
+            TupleArena* row_arena = storage == TupleStorage::ARENA ? &arena : nullptr;
+            for (uint16_t slot = 0; slot < num_tuples; slot++) {
+                page.GetTuple(slot, &rows.emplace_back(), row_arena);
+            }
+            benchmark::DoNotOptimize(rows.data());
+            rows.clear();
+            arena.Reset();
+        }
+        allocations = t_num_allocations - allocations;
+
+        auto num_rows = static_cast<double>(state.iterations() * num_tuples);
+        state.SetItemsProcessed(state.iterations() * num_tuples);
+        state.counters["mallocs_per_row"] = static_cast<double>(allocations) / num_rows;
+        state.SetLabel(StorageName(state.range(1)));
+    }
+    BENCHMARK(BM_TupleScanMaterialize)->ArgsProduct({{32, 128, 512}, {0, 1}});
+
+    /**
+     * 행마다 Tuple을 만들어 페이지에 삽입 (꽉 차면 Init). items = 삽입한 행 수
+     * arg0 = 튜플 크기, arg1 = 저장 방식 (arena면 페이지가 찰 때마다 Reset)
+     */
+    static void BM_TupleInsertPath(benchmark::State& state) {
+        const auto tuple_size = static_cast<uint32_t>(state.range(0));
+        const auto storage = static_cast<TupleStorage>(state.range(1));
+        std::vector<char> payload(tuple_size, 'x');
+
+        TupleArena arena;
+        TupleArena* row_arena = storage == TupleStorage::ARENA ? &arena : nullptr;
+        TablePage page;
+        page.Init(0);
+
+        uint64_t allocations = t_num_allocations;
+        for (auto _ : state) {
+            uint16_t slot_id;
+            Tuple tuple(payload.data(), tuple_size, row_arena);
+            if (!page.InsertTuple(tuple, &slot_id)) {
+                page.Init(0);
+                page.InsertTuple(tuple, &slot_id);
+                arena.Reset();
+            }
+        }
+        allocations = t_num_allocations - allocations;
+
+        state.SetItemsProcessed(state.iterations());
+        state.counters["mallocs_per_row"] = static_cast<double>(allocations) / static_cast<double>(state.iterations());
+        state.SetLabel(StorageName(state.range(1)));
+    }
+    BENCHMARK(BM_TupleInsertPath)->ArgsProduct({{32, 128, 512}, {0, 1}});
+}
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+
+#include "bench_util.hpp"
+#include "mydb/buffer/BufferPoolWarmer.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kWarmupBenchDb = "bench_warmup.db";
+    }
+
+    /**
+     * 재시작 직후 Zipf 요청 arg1개를 처리하는 시간 (8192페이지 = 128MB 파일, 풀 2048 프레임)
+     * arg0 = 0: 빈 풀로 시작 (cold)
+     *        1: 종료 직전 스냅샷으로 워밍업을 시작하고 바로 요청 시작 (코어가 하나면 워밍업과 요청이 번갈아 돎)
+     *        2: 워밍업이 끝난 뒤 요청 시작 (워밍업 시간 포함. hit 비율의 상한)
+     */
+    static void BM_RestartFirstRequests(benchmark::State& state) {
+        const auto mode = state.range(0);
+        const auto num_requests = static_cast<size_t>(state.range(1));
+        constexpr PageId kNumPages = 8192;
+        constexpr size_t kPoolSize = 2048;
+
+        bench::BenchFiles files(kWarmupBenchDb);
+        {
+            // 재시작 전: 한동안 트래픽을 받아 핫셋이 올라온 상태에서 스냅샷
+            DiskManager disk_manager(kWarmupBenchDb);
+            BufferPoolManager bpm(kPoolSize, &disk_manager);
+            bench::FillPages(&bpm, kNumPages);
+            bench::KeyGenerator keys(kNumPages, bench::Distribution::ZIPF, 1);
+            for (size_t i = 0; i < kPoolSize * 16; i++) {
+                auto page_id = static_cast<PageId>(keys.Next());
+                bpm.FetchPage(page_id);
+                bpm.UnpinPage(page_id, false);
+            }
+            BufferPoolWarmer(&bpm, &disk_manager).SaveSnapshot();
+        }
+
+        double hit_ratio = 0;
+        double warmup_ms = 0;
+        double batches = 0;
+        for (auto _ : state) {
+            DiskManager disk_manager(kWarmupBenchDb);
+            BufferPoolManager bpm(kPoolSize, &disk_manager);
+            BufferPoolWarmer warmer(&bpm, &disk_manager);
+            bench::KeyGenerator keys(kNumPages, bench::Distribution::ZIPF, 2);
+
+            auto start = std::chrono::steady_clock::now();
+            if (mode != 0) {
+                warmer.StartWarmup();
+            }
+            if (mode == 2) {
+                warmer.WaitForWarmup();
+            }
+            for (size_t i = 0; i < num_requests; i++) {
+                auto page_id = static_cast<PageId>(keys.Next());
+                benchmark::DoNotOptimize(bpm.FetchPage(page_id));
+                bpm.UnpinPage(page_id, false);
+            }
+            state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+            hit_ratio = bpm.GetMetricsSnapshot().HitRatio();
+            WarmupStats stats = warmer.WaitForWarmup();
+            warmup_ms = static_cast<double>(stats.duration.count()) / 1000.0;
+            batches = static_cast<double>(stats.batches);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_requests));
+        state.counters["hit_ratio"] = hit_ratio;
+        state.counters["warmup_ms"] = warmup_ms;
+        state.counters["batches"] = batches;
+    }
+    BENCHMARK(BM_RestartFirstRequests)->ArgsProduct({{0, 1, 2}, {2048, 16384}})
+        ->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(5);
+
+    // 스냅샷 저장 비용 (주기적으로 백그라운드에서 호출됨. 그동안 mutex_는 프레임 메타데이터를 훑는 동안만 잡힘)
+    static void BM_SaveResidencySnapshot(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+
+        bench::BenchFiles files(kWarmupBenchDb);
+        DiskManager disk_manager(kWarmupBenchDb);
+        BufferPoolManager bpm(pool_size, &disk_manager);
+        bench::FillPages(&bpm, static_cast<PageId>(pool_size));
+        BufferPoolWarmer warmer(&bpm, &disk_manager);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(warmer.SaveSnapshot());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pool_size));
+    }
+    BENCHMARK(BM_SaveResidencySnapshot)->RangeMultiplier(8)->Range(1024, 65536)->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+#include "bench_util.hpp"
+
+namespace mydb {
+
+    namespace {
+        const std::string kWorkloadBenchDb = "bench_workload.db";
+
+        std::unique_ptr<bench::BenchFiles> g_files;
+        std::unique_ptr<DiskManager> g_disk_manager;
+        std::unique_ptr<BufferPoolManager> g_bpm;
+        PageId g_num_pages = 0;
+
+        // 첫 페이지부터 next_page_id_를 따라가며 모든 튜플을 읽음. 읽은 튜플 수 반환
+        size_t ScanTable(BufferPoolManager* bpm, PageId first_page_id) {
+            size_t num_tuples = 0;
+            Tuple tuple;
+            PageId page_id = first_page_id;
+            while (page_id != INVALID_PAGE_ID) {
+                auto* page = reinterpret_cast<TablePage*>(bpm->FetchPage(page_id));
+                uint16_t num_slots = page->GetHeader()->num_slots_;
+                for (uint16_t slot = 0; slot < num_slots; slot++) {
+                    if (page->GetTuple(slot, &tuple)) {
+                        num_tuples++;
+                    }
+                }
+                PageId next_page_id = page->GetHeader()->next_page_id_;
+                bpm->UnpinPage(page_id, false);
+                page_id = next_page_id;
+            }
+            return num_tuples;
+        }
+    }
+
+    /**
+     * 벌크 로드: 튜플 arg0개를 TablePage 체인에 삽입 (풀 1024 프레임, 넘치면 dirty 페이지가 쫓겨나며 쓰임)
+     * arg1 = 튜플 크기
+     */
+    static void BM_BulkLoad(benchmark::State& state) {
+        const auto num_tuples = static_cast<size_t>(state.range(0));
+        const auto tuple_size = static_cast<size_t>(state.range(1));
+
+        for (auto _ : state) {
+            bench::BenchFiles files(kWorkloadBenchDb);
+            DiskManager disk_manager(kWorkloadBenchDb);
+            BufferPoolManager bpm(1024, &disk_manager);
+            bench::BulkLoad(&bpm, num_tuples, tuple_size);
+            bpm.FlushAllPages();
+        }
+        state.SetItemsProcessed(state.iterations() * num_tuples);
+        state.SetBytesProcessed(state.iterations() * num_tuples * tuple_size);
+    }
+    BENCHMARK(BM_BulkLoad)->ArgsProduct({{100'000, 1'000'000}, {64, 512}})->Unit(benchmark::kMillisecond);
+
+    /**
+     * 풀 스캔: 약 4096페이지(64MB) 테이블을 처음부터 끝까지 읽음
+     * arg0 = 풀 크기. 테이블보다 크면 전부 hit, 작으면 LRU + 순차 스캔이라 전부 miss
+     */
+    static void BM_FullScan(benchmark::State& state) {
+        const auto pool_size = static_cast<size_t>(state.range(0));
+        constexpr size_t kTupleSize = 128;
+        constexpr size_t kNumTuples = 4096 * (PAGE_TRAILER_OFFSET / (kTupleSize + sizeof(Slot)));
+
+        bench::BenchFiles files(kWorkloadBenchDb);
+        DiskManager disk_manager(kWorkloadBenchDb);
+        BufferPoolManager bpm(pool_size, &disk_manager);
+        PageId first_page_id = bench::BulkLoad(&bpm, kNumTuples, kTupleSize);
+        ScanTable(&bpm, first_page_id); // 한 번 훑어서 풀 상태를 안정화
+
+        BufferPoolMetricsSnapshot start = bpm.GetMetricsSnapshot();
+        size_t scanned = 0;
+        for (auto _ : state) {
+            scanned += ScanTable(&bpm, first_page_id);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(scanned));
+        state.SetBytesProcessed(static_cast<int64_t>(scanned * kTupleSize));
+        state.counters["hit_ratio"] = bpm.GetMetricsSnapshot().Since(start).HitRatio();
+    }
+    BENCHMARK(BM_FullScan)->Arg(1024)->Arg(8192)->Unit(benchmark::kMillisecond);
+
+    /**
+     * 읽기/쓰기 혼합: 페이지를 골라(분포) 읽기면 튜플 하나 조회, 쓰기면 튜플 하나 삽입 (꽉 차면 페이지 재초기화)
+     * TablePage에는 아직 래치가 없으므로 스레드마다 page_id % 스레드 수로 나눈 자기 구간에만 접근
+     * arg0 = 읽기 비율(%), arg1 = 분포 (0: uniform, 1: zipf). 데이터 8192페이지, 풀 1024프레임
+     */
+    static void BM_MixedReadWrite(benchmark::State& state) {
+        const auto read_percent = static_cast<uint64_t>(state.range(0));
+        const auto distribution = static_cast<bench::Distribution>(state.range(1));
+        constexpr size_t kTupleSize = 128;
+
+        if (state.thread_index() == 0) {
+            g_files = std::make_unique<bench::BenchFiles>(kWorkloadBenchDb);
+            g_disk_manager = std::make_unique<DiskManager>(kWorkloadBenchDb);
+            g_bpm = std::make_unique<BufferPoolManager>(1024, g_disk_manager.get());
+            g_num_pages = 8192;
+            for (PageId i = 0; i < g_num_pages; i++) {
+                PageId page_id;
+                auto* page = reinterpret_cast<TablePage*>(g_bpm->NewPage(&page_id));
+                page->Init(page_id);
+                g_bpm->UnpinPage(page_id, true);
+            }
+        }
+
+        const auto num_threads = static_cast<PageId>(state.threads());
+        const auto thread_index = static_cast<PageId>(state.thread_index());
+        const PageId pages_per_thread = g_num_pages / num_threads;
+
+        std::vector<char> payload(kTupleSize, 'x');
+        Tuple insert_tuple(payload.data(), kTupleSize);
+        Tuple read_tuple;
+        bench::KeyGenerator keys(pages_per_thread, distribution, 42 + thread_index);
+        std::mt19937 rng(7 + thread_index);
+        size_t writes = 0;
+
+        for (auto _ : state) {
+            PageId page_id = static_cast<PageId>(keys.Next()) * num_threads + thread_index;
+            bool is_read = rng() % 100 < read_percent;
+
+            auto* page = reinterpret_cast<TablePage*>(g_bpm->FetchPage(page_id));
+            if (is_read) {
+                uint16_t num_slots = page->GetHeader()->num_slots_;
+                if (num_slots > 0) {
+                    page->GetTuple(static_cast<uint16_t>(rng() % num_slots), &read_tuple);
+                }
+            } else {
+                uint16_t slot_id;
+                if (!page->InsertTuple(insert_tuple, &slot_id)) {
+                    page->Init(page_id);
+                }
+                writes++;
+            }
+            g_bpm->UnpinPage(page_id, !is_read);
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.counters["writes"] = benchmark::Counter(static_cast<double>(writes), benchmark::Counter::kIsRate);
+        state.SetLabel(bench::DistributionName(state.range(1)));
+
+        if (state.thread_index() == 0) {
+            g_bpm.reset();
+            g_disk_manager.reset();
+            g_files.reset();
+        }
+    }
+    BENCHMARK(BM_MixedReadWrite)->ArgsProduct({{50, 95}, {0, 1}})->ThreadRange(1, 4)->UseRealTime();
+}
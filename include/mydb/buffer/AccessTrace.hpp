@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "mydb/storage/Page.hpp"
+
+namespace mydb {
+
+    enum class TraceEventType : uint8_t {
+        FETCH = 0,
+        UNPIN = 1,
+        UNPIN_DIRTY = 2,
+        NEW_PAGE = 3,
+        DELETE = 4, // 프레임에 있던 페이지를 DeletePage로 버림 (프레임이 free list로 돌아감)
+    };
+
+    struct TraceEvent {
+        TraceEventType type_ = TraceEventType::FETCH;
+        PageId page_id_ = INVALID_PAGE_ID;
+    };
+
+    /**
+     * 트레이스 파일 형식
+     * [헤더 16B: magic 8B "MYDBTRC\0", version 4B, reserved 4B] [이벤트...]
+     * 이벤트 = varint( zigzag(page_id - 직전 이벤트의 page_id) << 3 | type )
+     * 같은/인접 페이지를 연달아 건드리는 경우(Fetch 직후 Unpin, 순차 스캔)가 대부분이라 이벤트당 보통 1바이트
+     * version 2: DELETE 추가로 type이 3비트 (version 1은 2비트)
+     */
+    constexpr char TRACE_MAGIC[8] = {'M', 'Y', 'D', 'B', 'T', 'R', 'C', '\0'};
+    constexpr uint32_t TRACE_VERSION = 2;
+
+    /**
+     * @brief 버퍼 풀 접근 트레이스 기록
+     * 스레드 안전하지 않음 (BufferPoolManager가 mutex_를 잡은 상태에서만 호출)
+     */
+    class TraceWriter {
+    public:
+        explicit TraceWriter(const std::string& path);
+        ~TraceWriter();
+
+        void Record(TraceEventType type, PageId page_id);
+
+        // 버퍼에 남은 이벤트를 파일에 씀
+        void Flush();
+
+        inline uint64_t get_num_events() const { return num_events_; }
+
+    private:
+        std::ofstream out_;
+        std::vector<char> buffer_;
+        PageId last_page_id_ = 0;
+        uint64_t num_events_ = 0;
+    };
+
+    /**
+     * @brief 트레이스 파일을 앞에서부터 순서대로 읽음 (큰 파일도 고정 크기 버퍼로 스트리밍)
+     */
+    class TraceReader {
+    public:
+        // 파일이 없거나 헤더가 맞지 않으면 std::runtime_error
+        explicit TraceReader(const std::string& path);
+
+        // 다음 이벤트 (끝이면 false). 파일 끝이 잘려 있으면 거기까지만 읽음
+        bool Next(TraceEvent* event);
+
+    private:
+        // 버퍼에서 1바이트 (파일 끝이면 false)
+        bool ReadByte(uint8_t* byte);
+
+        std::ifstream in_;
+        std::vector<char> buffer_;
+        size_t pos_ = 0;
+        size_t size_ = 0;
+        PageId last_page_id_ = 0;
+    };
+}
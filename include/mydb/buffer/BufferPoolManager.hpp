@@ -1,22 +1,109 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
-#include "mydb/buffer/LRUReplacer.hpp"
+#include "mydb/buffer/AccessTrace.hpp"
+#include "mydb/buffer/FrameArena.hpp"
+#include "mydb/buffer/Replacer.hpp"
+#include "mydb/common/Metrics.hpp"
+#include "mydb/recovery/LogManager.hpp"
 #include "mydb/storage/DiskManager.hpp"
 #include "mydb/storage/Page.hpp"
 
 namespace mydb {
 
+    /**
+     * @brief 프레임 하나의 메모리 상 메타데이터 (페이지 데이터와 분리해서 작은 배열로 관리)
+     * GetDirtyPageTable, FlushAllPages처럼 전체 프레임을 훑는 작업이 16KB 간격의 페이지들이 아니라
+     * 연속된 작은 구조체만 읽게 됨
+     */
+    struct FrameMeta {
+        PageId page_id_ = INVALID_PAGE_ID;
+        int pin_count_ = 0; // 현재 이 페이지를 보고 있는 스레드 수
+        bool is_dirty_ = false; // (마지막 디스크에서 쓴/읽은 시점 이후) 데이터 변경 여부. (true면 디스크에 다시 써야함)
+        uint32_t dirty_gen_ = 0; // UnpinPage(dirty)마다 증가. 백그라운드 쓰기 도중 페이지가 또 바뀌었는지 확인용
+        Lsn rec_lsn_ = INVALID_LSN; // 디스크에 아직 없는 변경 중 가장 오래된 것의 LSN 하한 (체크포인트의 dirty page table용)
+        uint64_t last_access_ = 0; // 마지막으로 pin된 시점 (access_clock_ 값). 상주 페이지 스냅샷의 최근 순서용
+        bool prewarmed_ = false; // 워밍업으로 올라온 뒤 아직 한 번도 요청되지 않음
+    };
+
+    // 버퍼 풀 hot path 지표 (항상 켜져 있음)
+    struct BufferPoolMetrics {
+        ShardedCounter fetch_hits;
+        ShardedCounter fetch_misses;
+        ShardedCounter new_pages;
+        ShardedCounter evictions;        // replacer가 고른 victim 수
+        ShardedCounter dirty_writebacks; // 그중 쫓겨나기 전에 디스크에 써야 했던 페이지 수
+        ShardedCounter prewarmed_pages;  // 재시작 후 워밍업으로 미리 올린 페이지 수
+        ShardedCounter prewarm_hits;     // 그중 실제로 요청된 페이지 수 (워밍업이 막아준 miss)
+        ShardedCounter lock_acquisitions;
+        ShardedCounter lock_contentions; // mutex_를 바로 못 잡고 기다린 횟수
+        LatencyHistogram lock_wait;      // 기다린 시간 (기다린 경우만 기록)
+    };
+
+    /**
+     * @brief 버퍼 풀 + 디스크 I/O 지표 스냅샷
+     * 두 스냅샷의 차이(Since)로 구간별 값을 구할 수 있음
+     */
+    struct BufferPoolMetricsSnapshot {
+        std::chrono::steady_clock::time_point taken_at;
+
+        uint64_t fetch_hits = 0;
+        uint64_t fetch_misses = 0;
+        uint64_t new_pages = 0;
+        uint64_t evictions = 0;
+        uint64_t dirty_writebacks = 0;
+        uint64_t prewarmed_pages = 0;
+        uint64_t prewarm_hits = 0;
+        uint64_t lock_acquisitions = 0;
+        uint64_t lock_contentions = 0;
+        HistogramSnapshot lock_wait;
+
+        uint64_t pages_read = 0;
+        uint64_t pages_written = 0;
+        HistogramSnapshot read_latency;
+        HistogramSnapshot batch_read_latency;
+        HistogramSnapshot write_latency;
+
+        // FetchPage 중 메모리에서 바로 찾은 비율 (요청이 없으면 0)
+        double HitRatio() const;
+
+        BufferPoolMetricsSnapshot Since(const BufferPoolMetricsSnapshot& earlier) const;
+    };
+
+    struct BufferPoolOptions {
+        // 프레임 메모리 할당 방식 (huge page, NUMA 배치)
+        FrameArenaOptions arena;
+
+        /*
+         * true면 프레임을 쓰지 않고 DB 파일을 읽기 전용으로 mmap해서, FetchPage가 매핑 안을 직접 가리키는 Page를 반환
+         * (읽기 전용 복제본, 분석용 스냅샷용. 커널 -> 프레임 복사가 없고 교체도 커널 페이지 캐시가 함)
+         * 반환된 페이지에 쓰면 SIGSEGV. NewPage, FlushPage 등 쓰기 작업은 모두 실패하고, LogManager와 같이 쓸 수 없음
+         * DiskManager도 TablespaceOptions::read_only로 열어야 함 (데이터 파일을 O_RDONLY로 열고, 종료할 때 건드리지 않음)
+         */
+        bool mmap_read_only = false;
+        AccessPattern mmap_access_pattern = AccessPattern::RANDOM;
+
+        // 교체 정책 (트레이스를 ReplacementSimulator로 재생해서 워크로드에 맞는 것을 고를 수 있음)
+        ReplacerType replacer = ReplacerType::LRU;
+    };
+
     class BufferPoolManager {
     public:
         /**
          * @param pool_size 버퍼 풀에 동시에 둘 수 있는 페이지 수
+         * @param log_manager 있으면 dirty 페이지를 디스크에 쓰기 전에 해당 페이지 LSN까지 로그를 먼저 영속화 (WAL)
+         * @param options 프레임 할당 방식, 읽기 전용 mmap 모드
          */
-        BufferPoolManager(size_t pool_size, DiskManager *disk_manager);
+        BufferPoolManager(size_t pool_size, DiskManager *disk_manager, LogManager* log_manager = nullptr,
+                          const BufferPoolOptions& options = {});
 
         ~BufferPoolManager();
 
@@ -24,6 +111,7 @@ namespace mydb {
          * @brief 디스크에서 페이지를 가져옴
          * 메모리에 있으면, 포인터 반환
          * 없으면 디스크에서 메모리로 로드한 후, 포인터 반환
+         * @throws PageCorruptionError 디스크의 페이지 체크섬이 맞지 않을 때 (프레임은 반납됨)
          */
         Page* FetchPage(PageId page_id);
 
@@ -44,11 +132,98 @@ namespace mydb {
         bool FlushPage(PageId page_id);
 
         /**
-         * @brief <b>메모리 상의</b> 특정 페이지 데이터 삭제
+         * @brief 페이지 삭제: 메모리에 있으면 프레임을 비우고(dirty여도 쓰지 않음), 페이지 ID를 DiskManager에 반납
+         * 반납된 ID는 이후 NewPage가 다시 쓸 수 있음
+         * @return pin 상태라 지울 수 없거나, 이미 삭제됐거나 할당된 적 없는 페이지면 false
          */
         bool DeletePage(PageId page_id);
 
+        /**
+         * @brief 임시 페이지(정렬 run, 해시 spill)용 NewPage / DeletePage
+         * ID를 DiskManager의 임시 페이지 풀에서 받고 돌려줌 -> 반납하기 전에 크래시가 나도 다음 시작 때 free list로 돌아감
+         * 임시 페이지는 DeletePage가 아니라 DeleteTempPage로 지워야 함 (DeletePage는 false)
+         */
+        Page* NewTempPage(PageId* page_id);
+        bool DeleteTempPage(PageId page_id);
+
+        /**
+         * @brief dirty 상태인 모든 페이지를 디스크에 씀 (정상 종료 시)
+         */
+        void FlushAllPages();
+
+        /**
+         * @brief 체크포인트용 백그라운드 쓰기
+         * FlushPage와 달리 mutex_는 페이지를 scratch로 복사하는 동안만 잡고, 로그 flush와 디스크 쓰기는 락 밖에서 함
+         * (그동안 다른 스레드의 FetchPage/UnpinPage가 막히지 않음)
+         * @param scratch 복사본을 담을 버퍼 (호출한 쪽이 재사용)
+         * @return 실제로 썼으면 true (메모리에 없거나 clean이면 false)
+         */
+        bool WriteBackPage(PageId page_id, Page* scratch);
+
+        /**
+         * @brief 현재 dirty page table 스냅샷: (page_id, rec_lsn)
+         * rec_lsn보다 앞선 로그는 이미 디스크의 페이지에 반영되어 있음을 뜻함 (체크포인트에 기록)
+         */
+        std::vector<std::pair<PageId, Lsn>> GetDirtyPageTable();
+
+        /**
+         * @brief 읽기 전용 mmap 모드에서 접근 패턴 힌트 변경 (스캔 시작/끝). 일반 모드에서는 무시
+         * @param count 0이면 파일 전체
+         */
+        void AdviseAccess(AccessPattern pattern, PageId first = 0, PageId count = 0);
+
+        inline bool is_read_only() const { return read_only_; }
+
+        /**
+         * @brief 지금부터 FetchPage/UnpinPage/NewPage 호출을 트레이스 파일에 기록 (이미 기록 중이면 새 파일로 교체)
+         * 기록은 mutex_ 안에서 버퍼에 varint 몇 바이트를 쓰는 정도라 켜둔 채로 운영 워크로드를 받을 수 있음
+         * @throws std::runtime_error 파일을 열 수 없거나 읽기 전용 mmap 모드일 때
+         */
+        void StartTrace(const std::string& path);
+
+        /**
+         * @brief 트레이스 기록을 멈추고 파일을 닫음
+         * @return 기록한 이벤트 수 (기록 중이 아니었으면 0)
+         */
+        uint64_t StopTrace();
+
+        /**
+         * @brief 지금 메모리에 있는 페이지 ID 목록 (최근에 pin된 순서, 임시 페이지 제외)
+         * 재시작 후 워밍업용 스냅샷 (BufferPoolWarmer)
+         */
+        std::vector<PageId> GetResidentPages();
+
+        /**
+         * @brief 페이지 epoch: 페이지가 풀에서 나갈 때(쫓겨남, 삭제)마다 증가하는 값
+         * 워밍업은 디스크에서 읽기 전에 받아 두고 PrewarmPages에 넘김
+         */
+        uint64_t GetPageEpoch();
+
+        /**
+         * @brief 디스크에서 미리 읽어둔 연속 페이지 [first, first + count)를 빈 프레임에 올림 (pin하지 않음, 교체 순서는 가장 오래된 쪽)
+         * 이미 메모리에 있는 페이지는 건너뛰고, 빈 프레임이 없으면 멈춤 (워밍업이 트래픽이 올린 페이지를 쫓아내지 않게)
+         * free list에 있는 페이지(스냅샷 이후 반납됐거나, 크래시 후 .spill에서 돌아온 임시 페이지)와 임시 페이지도 건너뜀
+         * read_epoch 이후 풀에서 나간 페이지도 건너뜀 (읽는 사이 트래픽이 올려서 고치고 다시 썼으면 data가 옛 이미지임)
+         * @param data 체크섬 검증이 끝난 페이지 데이터 count개
+         * @param read_epoch data를 읽기 전에 GetPageEpoch로 받은 값
+         * @param pool_full 빈 프레임이 다 떨어졌으면 true로 설정
+         * @return 새로 올린 페이지 수
+         */
+        size_t PrewarmPages(PageId first, PageId count, const char* data, uint64_t read_epoch, bool* pool_full);
+
+        inline size_t get_pool_size() const { return pool_size_; }
+
+        // 버퍼 풀과 DiskManager의 지표를 한 번에 읽음 (락 없음. 각 값은 읽는 순간의 값이라 서로 약간 어긋날 수 있음)
+        BufferPoolMetricsSnapshot GetMetricsSnapshot() const;
+
     private:
+        // mutex_ 획득. 바로 잡히면 try_lock 한 번으로 끝나고, 기다린 경우만 시간을 잼
+        std::unique_lock<std::mutex> LockPool();
+
+        // NewPage / NewTempPage, DeletePage / DeleteTempPage 공통 (temp면 ID를 임시 페이지 풀에서 받고 돌려줌)
+        Page* NewPageImpl(PageId* page_id, bool temp);
+        bool DeletePageImpl(PageId page_id, bool temp);
+
         /**
          * @brief 빈 프레임 id 가져옴
          * 1. free_list_에 빈 게 있으면 쓰고,
@@ -56,19 +231,59 @@ namespace mydb {
          */
         bool FindFreeFrameFromVictim(FrameId* frame_id);
 
+        /**
+         * @brief 페이지 적재에 실패한 프레임을 free_list_로 되돌림 (mutex_를 잡은 상태에서 호출)
+         */
+        void ReleaseFrame(FrameId frame_id);
+
+        // pin할 때 rec_lsn_ 기록 (mutex_를 잡은 상태에서 호출)
+        void TrackRecLsn(FrameMeta& meta);
+
+        // 재사용된 ID에 남은 옛 프레임을 버림 (mutex_를 잡은 상태에서 호출)
+        void DropStaleFrame(PageId page_id);
+
+        // 페이지가 풀에서 나갈 때 epoch 기록 (mutex_를 잡은 상태에서 호출)
+        void BumpPageEpoch(PageId page_id);
+
+        // 읽기 전용 mmap 모드의 FetchPage (락 없음). 처음 접근하는 페이지만 체크섬 검증
+        Page* FetchMappedPage(PageId page_id);
+
         size_t pool_size_;
 
+        // 프레임 i의 데이터 = pages_[i] (arena_ 위에 PAGE_SIZE 간격으로 배치), 메타데이터 = frames_[i]
+        std::unique_ptr<FrameArena> arena_;
         Page* pages_;
+        std::vector<FrameMeta> frames_;
 
         // 외부 주입받거나, 내부에서 생성
         DiskManager* disk_manager_;
-        LRUReplacer* replacer_;
+        LogManager* log_manager_;
+        std::unique_ptr<Replacer> replacer_;
 
         // PageId -> FrameId 매핑 테이블
         std::unordered_map<PageId, FrameId> page_table_;
 
         std::list<FrameId> free_list_;
 
+        // pin할 때마다 증가하는 논리 시계 (mutex_로 보호)
+        uint64_t access_clock_ = 0;
+
+        /* 페이지가 풀에서 마지막으로 나간 시점 (page_epoch_clock_ 값, mutex_로 보호)
+         * 페이지마다 두지 않고 page_id % PAGE_EPOCH_SLOTS 칸을 같이 씀 (겹치면 워밍업이 더 건너뛸 뿐 틀리지 않음)
+         */
+        static constexpr size_t PAGE_EPOCH_SLOTS = 4096;
+        std::vector<uint64_t> page_epochs_;
+        uint64_t page_epoch_clock_ = 0;
+
+        // 읽기 전용 mmap 모드: 체크섬을 검증한 페이지 비트맵 (page_id 하나당 1비트)
+        bool read_only_ = false;
+        std::unique_ptr<std::atomic<uint64_t>[]> verified_;
+
         std::mutex mutex_;
+
+        // 접근 트레이스 (기록 중일 때만. mutex_로 보호)
+        std::unique_ptr<TraceWriter> trace_;
+
+        BufferPoolMetrics metrics_;
     };
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    struct WarmupOptions {
+        // 상주 페이지 스냅샷 파일. 비어 있으면 DB 파일과 같은 경로에 확장자만 .warm으로 바꾼 파일
+        std::string snapshot_path;
+
+        // 백그라운드 스냅샷 주기
+        std::chrono::milliseconds snapshot_interval = std::chrono::seconds(60);
+
+        // 워밍업 읽기 한 번에 읽을 최대 연속 페이지 수 (64 = 1MB)
+        PageId max_batch_pages = 64;
+    };
+
+    struct WarmupStats {
+        size_t snapshot_pages = 0; // 스냅샷에서 읽은 페이지 수 (풀 크기를 넘는 부분은 제외)
+        size_t loaded_pages = 0;   // 실제로 프레임에 올린 페이지 수
+        size_t skipped_pages = 0;  // 이미 메모리에 있었거나, 읽는 사이 풀에 올라왔다 나갔거나, 파일 범위 밖이거나, 체크섬이 맞지 않은 페이지 수
+        size_t batches = 0;        // 디스크 읽기 횟수
+        std::chrono::microseconds duration{0}; // 워밍업 시작 ~ 끝 (time-to-warm)
+        bool done = false;
+    };
+
+    /**
+     * @brief 재시작 직후의 cold miss를 줄이기 위한 상주 페이지 스냅샷 + 백그라운드 워밍업
+     *
+     * 실행 중: 주기적으로 버퍼 풀에 있는 페이지 ID를 최근 순서로 파일에 저장 (임시 파일에 쓰고 rename)
+     * 재시작 후: 스냅샷의 앞쪽(최근) 풀 크기만큼을 ID 순으로 정렬해서, 연속 구간을 큰 순차 읽기로 묶어 빈 프레임에 올림.
+     * 워밍업은 빈 프레임만 쓰고 트래픽이 이미 올린 페이지는 건너뛰므로, 워밍업 도중에도 정상적으로 요청을 받을 수 있음
+     */
+    class BufferPoolWarmer {
+    public:
+        BufferPoolWarmer(BufferPoolManager* bpm, DiskManager* disk_manager, WarmupOptions options = {});
+
+        ~BufferPoolWarmer();
+
+        // 주기적 스냅샷 스레드 시작/종료 (Stop은 마지막으로 한 번 더 저장)
+        void Start();
+        void Stop();
+
+        // 스냅샷 한 번 저장 (호출한 스레드에서). 저장한 페이지 수 반환
+        size_t SaveSnapshot();
+
+        // 스냅샷 파일 읽기. 없거나 형식이 맞지 않으면 빈 목록 (재시작을 막지 않음)
+        static std::vector<PageId> LoadSnapshot(const std::string& path);
+
+        // 백그라운드 워밍업 시작 (스냅샷이 없으면 바로 끝남)
+        void StartWarmup();
+
+        // 워밍업이 끝날 때까지 대기
+        WarmupStats WaitForWarmup();
+
+        WarmupStats GetWarmupStats();
+
+        inline const std::string& get_snapshot_path() const { return options_.snapshot_path; }
+
+    private:
+        void SnapshotThreadMain();
+        void WarmupThreadMain();
+
+        // 연속 구간 [first, first + count)를 읽어서 검증된 부분만 버퍼 풀에 올림. 풀이 꽉 차면 false
+        bool LoadRun(PageId first, PageId count, std::vector<char>& buffer, WarmupStats& stats);
+
+        BufferPoolManager* bpm_;
+        DiskManager* disk_manager_;
+        WarmupOptions options_;
+
+        // 스냅샷 저장은 한 번에 하나만 (임시 파일 이름이 같음)
+        std::mutex snapshot_mutex_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool running_ = false;
+        std::thread snapshot_thread_;
+
+        std::atomic<bool> cancel_warmup_{false};
+        std::thread warmup_thread_;
+        WarmupStats warmup_stats_;
+    };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "mydb/buffer/Replacer.hpp"
+
+namespace mydb {
+
+    /**
+     * @brief CLOCK (second chance) 교체 정책
+     * 프레임마다 참조 비트 하나만 두고, 시곗바늘이 돌면서 참조 비트가 꺼진 프레임을 victim으로 고름
+     * (참조 비트가 켜져 있으면 끄고 한 번 더 기회를 줌)
+     * LRU와 달리 Pin/Unpin이 리스트/해시 조작 없이 배열 접근 한 번이라 hit 경로가 가벼움
+     */
+    class ClockReplacer : public Replacer {
+    public:
+        explicit ClockReplacer(size_t num_pages);
+
+        ~ClockReplacer() override = default;
+
+        bool Victim(FrameId* frame_id) override;
+
+        void Pin(FrameId frame_id) override;
+
+        void Unpin(FrameId frame_id) override;
+
+        void UnpinCold(FrameId frame_id) override;
+
+        size_t Size() override;
+
+    private:
+        struct Entry {
+            bool in_replacer_ = false; // 교체 후보인지 (pin count가 0)
+            bool referenced_ = false;  // 마지막으로 바늘이 지나간 뒤 다시 쓰였는지
+        };
+
+        std::mutex mutex_;
+        std::vector<Entry> entries_;
+        size_t hand_ = 0;
+        size_t size_ = 0;
+    };
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mydb {
+
+    // 프레임 메모리의 NUMA 배치 정책
+    enum class NumaPolicy {
+        DEFAULT,    // 커널 기본값 (처음 접근한 스레드의 노드)
+        INTERLEAVE, // 모든 노드에 페이지 단위로 번갈아 배치 (노드 간 대역폭 분산)
+        BIND,       // numa_node 하나에만 배치
+    };
+
+    struct FrameArenaOptions {
+        // MAP_HUGETLB(미리 예약된 huge page)를 먼저 시도하고, 실패하면 일반 mmap + THP(madvise)로 대체
+        bool use_huge_pages = true;
+
+        NumaPolicy numa_policy = NumaPolicy::DEFAULT;
+
+        // BIND일 때 사용할 노드 번호
+        int numa_node = 0;
+    };
+
+    /**
+     * @brief 버퍼 풀 프레임용 메모리 영역
+     * new Page[]와 달리 익명 mmap으로 잡기만 하고 건드리지 않으므로,
+     * 물리 메모리는 각 프레임이 처음 쓰일 때 커널이 0으로 채워서 할당한다. (풀 크기와 무관하게 생성이 즉시 끝남)
+     * huge page를 쓰면 풀 전체를 훨씬 적은 TLB 엔트리로 덮을 수 있음.
+     */
+    class FrameArena {
+    public:
+        FrameArena(size_t size, const FrameArenaOptions& options = {});
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        inline char* get_data() const { return data_; }
+        inline size_t get_size() const { return size_; }
+
+        // MAP_HUGETLB로 잡았는지 (false면 일반 페이지 + THP 요청)
+        inline bool is_huge_tlb() const { return huge_tlb_; }
+
+        // NUMA 정책 적용에 성공했는지 (DEFAULT면 항상 false)
+        inline bool is_numa_applied() const { return numa_applied_; }
+
+    private:
+        // mbind 시스템 콜로 정책 적용 (libnuma 없이)
+        bool ApplyNumaPolicy(const FrameArenaOptions& options);
+
+        char* data_ = nullptr;
+        size_t size_ = 0;     // 요청 크기
+        size_t map_size_ = 0; // 실제 mmap 크기 (huge page 단위로 올림)
+        bool huge_tlb_ = false;
+        bool numa_applied_ = false;
+    };
+}
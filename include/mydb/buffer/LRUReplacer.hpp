@@ -5,30 +5,32 @@
 #include <mutex>            // 동시성 제어
 #include <optional>
 
-namespace mydb {
+#include "mydb/buffer/Replacer.hpp"
 
-    using FrameId = uint32_t;
+namespace mydb {
 
     /**
      * @brief 캐시? 공간이 다 찼을 때, 마지막 사용 시점이 가장 오래된 데이터를 버림
      * (Least Recently Used)
      */
-    class LRUReplacer {
+    class LRUReplacer : public Replacer {
     public:
         explicit LRUReplacer(size_t num_pages);
 
-        ~LRUReplacer() = default;
+        ~LRUReplacer() override = default;
+
+        bool Victim(FrameId* frame_id) override;
 
-        bool Victim(FrameId* frame_id);
+        void Unpin(FrameId frame_id) override;
 
-        void Unpin(FrameId frame_id);
+        void UnpinCold(FrameId frame_id) override;
 
-        void Pin(FrameId frame_id);
+        void Pin(FrameId frame_id) override;
 
         /**
          * 현재 관리대상인(비워질 가능성이 있는) 프레임 수
          */
-        size_t Size();
+        size_t Size() override;
 
     private:
         std::mutex mutex_;
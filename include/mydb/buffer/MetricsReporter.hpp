@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    /**
+     * @brief 버퍼 풀 지표를 주기적으로 spdlog에 남김
+     * 매 주기마다 직전 리포트 이후 구간의 값(처리량, hit 비율, 지연시간 백분위)을 한 줄로 기록
+     */
+    class MetricsReporter {
+    public:
+        explicit MetricsReporter(BufferPoolManager* bpm, std::chrono::milliseconds interval = std::chrono::seconds(10));
+
+        ~MetricsReporter();
+
+        // 백그라운드 스레드 시작/종료
+        void Start();
+        void Stop();
+
+        // 직전 리포트 이후 구간을 지금 바로 기록하고, 기록한 문자열 반환
+        std::string Report();
+
+        // 스냅샷 구간 하나를 사람이 읽을 수 있는 한 줄로
+        static std::string Format(const BufferPoolMetricsSnapshot& interval, double seconds);
+
+    private:
+        void ThreadMain();
+
+        BufferPoolManager* bpm_;
+        std::chrono::milliseconds interval_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool running_ = false;
+        std::thread thread_;
+        BufferPoolMetricsSnapshot last_;
+    };
+}
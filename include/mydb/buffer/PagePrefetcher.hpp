@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    // 프리페치 요청 하나의 상태 (PagePrefetcher 안에서만 바꿈)
+    struct PrefetchRequest {
+        enum class State { QUEUED, LOADING, DONE, CANCELLED };
+
+        PageId page_id_;
+        State state_ = State::QUEUED;
+        Page* page_ = nullptr;       // DONE이고 성공했으면 pin된 페이지
+        std::exception_ptr error_;   // FetchPage가 던진 예외
+    };
+
+    /**
+     * @brief 곧 읽을 페이지를 백그라운드 스레드가 미리 FetchPage(pin)해 둠
+     * 순서대로 읽는 쪽(정렬 run 병합 등)이 지금 페이지를 처리하는 동안 다음 페이지의 디스크 읽기가 진행되게 함.
+     * 요청은 받은 순서대로 처리하고, 가져온 페이지의 pin은 Take한 쪽이 넘겨받음 (다 쓰면 UnpinPage)
+     * 받은 요청은 소멸 전에 모두 Take 또는 Cancel해야 함
+     */
+    class PagePrefetcher {
+    public:
+        using Handle = std::shared_ptr<PrefetchRequest>;
+
+        explicit PagePrefetcher(BufferPoolManager* bpm);
+
+        ~PagePrefetcher();
+
+        PagePrefetcher(const PagePrefetcher&) = delete;
+        PagePrefetcher& operator=(const PagePrefetcher&) = delete;
+
+        // page_id를 읽기 대기열에 넣음
+        Handle Request(PageId page_id);
+
+        /**
+         * @brief 요청한 페이지를 받음 (아직 읽는 중이면 끝날 때까지 기다림). pin은 호출한 쪽으로 넘어감
+         * @throws FetchPage가 던진 예외, 빈 프레임이 없으면 std::runtime_error
+         */
+        Page* Take(const Handle& request);
+
+        // 요청 취소. 이미 읽는 중이면 끝날 때까지 기다렸다가 unpin (반환 후에는 페이지가 pin되어 있지 않음)
+        void Cancel(const Handle& request);
+
+        // Take 중에 읽기가 끝나지 않아 기다린 횟수 (프리페치가 늦은 횟수)
+        inline size_t get_num_waits() const { return num_waits_; }
+
+    private:
+        void ThreadMain();
+
+        BufferPoolManager* bpm_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;      // 새 요청 / 종료 알림 (프리페치 스레드가 기다림)
+        std::condition_variable done_cv_; // 요청 완료 알림 (Take, Cancel이 기다림)
+        std::deque<Handle> queue_;
+        bool running_ = true;
+        size_t num_waits_ = 0;
+        std::thread thread_;
+    };
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mydb/buffer/AccessTrace.hpp"
+#include "mydb/buffer/Replacer.hpp"
+
+namespace mydb {
+
+    struct SimulationResult {
+        ReplacerType policy = ReplacerType::LRU;
+        size_t pool_size = 0;
+
+        uint64_t fetches = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t new_pages = 0;
+        uint64_t evictions = 0;
+        uint64_t dirty_writebacks = 0;
+
+        // 모든 프레임이 pin 상태라 페이지를 올리지 못한 횟수 (풀이 동시에 잡히는 페이지 수보다 작을 때)
+        uint64_t stalls = 0;
+
+        double HitRatio() const {
+            return fetches == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(fetches);
+        }
+    };
+
+    /**
+     * @brief 트레이스를 임의의 교체 정책 + 풀 크기로 재생하는 오프라인 시뮬레이터
+     * 페이지 데이터나 디스크 없이 BufferPoolManager의 프레임 관리(page table, pin count, dirty, replacer)만 흉내냄
+     */
+    class ReplacementSimulator {
+    public:
+        ReplacementSimulator(ReplacerType policy, size_t pool_size);
+
+        void Apply(const TraceEvent& event);
+
+        inline const SimulationResult& get_result() const { return result_; }
+
+        /**
+         * @brief 트레이스를 한 번만 읽으면서 (정책 x 풀 크기) 조합을 모두 시뮬레이션 (hit 비율 곡선)
+         * 결과는 정책 순서, 그 안에서 풀 크기 순서
+         */
+        static std::vector<SimulationResult> Replay(const std::string& trace_path,
+                                                    const std::vector<ReplacerType>& policies,
+                                                    const std::vector<size_t>& pool_sizes);
+
+    private:
+        struct Frame {
+            PageId page_id_ = INVALID_PAGE_ID;
+            int pin_count_ = 0;
+            bool is_dirty_ = false;
+        };
+
+        // 새 페이지를 올릴 프레임 확보 (없으면 false)
+        bool AcquireFrame(PageId page_id, FrameId* frame_id);
+
+        // 페이지가 프레임에 있으면 매핑을 지우고 프레임을 free_frames_로 돌려줌 (DeletePage)
+        void DropPage(PageId page_id);
+
+        std::unique_ptr<Replacer> replacer_;
+        std::vector<Frame> frames_;
+        std::deque<FrameId> free_frames_;
+        std::unordered_map<PageId, FrameId> page_table_;
+        SimulationResult result_;
+    };
+}
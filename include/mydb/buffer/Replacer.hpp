@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace mydb {
+
+    using FrameId = uint32_t;
+
+    /**
+     * @brief 교체 정책 공통 인터페이스
+     * 버퍼 풀은 pin count가 0이 된 프레임을 Unpin으로 넘기고, 다시 쓰기 시작하면 Pin으로 빼냄.
+     * 빈 프레임이 없을 때 Victim으로 쫓아낼 프레임을 고름
+     */
+    class Replacer {
+    public:
+        virtual ~Replacer() = default;
+
+        // 쫓아낼 프레임 선택 (후보가 없으면 false)
+        virtual bool Victim(FrameId* frame_id) = 0;
+
+        // 사용 시작: 교체 후보에서 제외
+        virtual void Pin(FrameId frame_id) = 0;
+
+        // 사용 끝: 교체 후보에 추가
+        virtual void Unpin(FrameId frame_id) = 0;
+
+        // 아직 아무도 쓰지 않은 프레임(워밍업으로 올린 페이지 등)을 가장 먼저 쫓겨날 자리에 추가
+        virtual void UnpinCold(FrameId frame_id) = 0;
+
+        /**
+         * 현재 관리대상인(비워질 가능성이 있는) 프레임 수
+         */
+        virtual size_t Size() = 0;
+    };
+
+    enum class ReplacerType {
+        LRU,
+        CLOCK,
+    };
+
+    std::unique_ptr<Replacer> MakeReplacer(ReplacerType type, size_t num_pages);
+
+    // "lru", "clock" <-> ReplacerType (시뮬레이터 명령행 인자용). 모르는 이름이면 false
+    bool ParseReplacerType(const std::string& name, ReplacerType* type);
+    const char* ReplacerTypeName(ReplacerType type);
+}
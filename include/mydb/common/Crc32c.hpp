@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mydb {
+
+    /**
+     * @brief CRC32C (Castagnoli) 체크섬 계산
+     * SSE4.2를 지원하는 CPU면 crc32 명령어를, 아니면 테이블 기반(slicing-by-8) 구현을 사용.
+     * 어떤 구현을 쓸지는 처음 호출될 때 런타임에 한 번만 결정한다.
+     *
+     * @param crc 이어서 계산할 때 넘기는 이전 결과값 (처음이면 0)
+     */
+    uint32_t Crc32c(const void* data, size_t length, uint32_t crc = 0);
+
+    // 구현별 직접 호출용 (테스트, 벤치마크에서 비교할 때 사용)
+    uint32_t Crc32cPortable(const void* data, size_t length, uint32_t crc = 0);
+    uint32_t Crc32cHardware(const void* data, size_t length, uint32_t crc = 0);
+
+    // 현재 CPU에서 하드웨어 CRC32C를 쓸 수 있는지
+    bool Crc32cHardwareAvailable();
+}
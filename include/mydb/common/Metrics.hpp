@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mydb {
+
+    // false sharing 방지용 캐시 라인 크기
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // 카운터/히스토그램을 나누는 샤드 수. 스레드마다 샤드 하나를 골라 쓰므로 스레드 간 캐시 라인 경합이 거의 없음
+    constexpr size_t METRICS_SHARDS = 16;
+
+    /**
+     * @brief 현재 스레드가 쓸 샤드 번호
+     * 스레드가 처음 호출할 때 라운드 로빈으로 정해지고 이후 고정 (thread_local)
+     */
+    inline size_t CurrentMetricsShard() {
+        static std::atomic<size_t> next_shard{0};
+        thread_local size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % METRICS_SHARDS;
+        return shard;
+    }
+
+    /**
+     * @brief 샤드별로 캐시 라인을 따로 쓰는 카운터
+     * 증가는 relaxed atomic add 한 번. 읽을 때 모든 샤드를 더함 (읽기는 드물다는 가정)
+     */
+    class ShardedCounter {
+    public:
+        inline void Add(uint64_t n = 1) {
+            shards_[CurrentMetricsShard()].value_.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        uint64_t Load() const;
+
+    private:
+        struct alignas(CACHE_LINE_SIZE) Shard {
+            std::atomic<uint64_t> value_{0};
+        };
+
+        std::array<Shard, METRICS_SHARDS> shards_;
+    };
+
+    /**
+     * @brief 히스토그램 스냅샷 (샤드를 합친 결과)
+     */
+    struct HistogramSnapshot {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        std::vector<uint64_t> buckets;
+
+        // p: 0 ~ 100. 해당 백분위 값이 들어있는 버킷의 상한 (값이 없으면 0)
+        uint64_t Percentile(double p) const;
+
+        // 기록된 가장 큰 값이 들어있는 버킷의 상한
+        uint64_t Max() const;
+
+        double Mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count); }
+
+        // 다른 스냅샷과의 차이 (주기적 리포트에서 구간별 분포를 볼 때)
+        HistogramSnapshot Since(const HistogramSnapshot& earlier) const;
+    };
+
+    /**
+     * @brief HDR 스타일(log-linear) 지연시간 히스토그램 (단위: ns)
+     * 2의 거듭제곱 구간마다 16개 버킷으로 나눠서, 값의 크기와 무관하게 상대 오차가 1/16 이하.
+     * 기록은 버킷 하나와 합계에 relaxed atomic add 두 번 (샤드 단위라 경합 없음)
+     */
+    class LatencyHistogram {
+    public:
+        // 2^SUB_BUCKET_BITS개로 각 구간을 나눔
+        static constexpr int SUB_BUCKET_BITS = 4;
+        static constexpr uint64_t SUB_BUCKETS = 1ULL << SUB_BUCKET_BITS;
+
+        // 2^MAX_EXPONENT ns(약 18분) 이상은 마지막 버킷 하나로 모음
+        static constexpr int MAX_EXPONENT = 40;
+        static constexpr size_t NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + 1;
+
+        LatencyHistogram();
+        ~LatencyHistogram();
+
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        inline void Record(uint64_t value) {
+            Shard& shard = shards_[CurrentMetricsShard()];
+            shard.buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+            shard.sum_.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        inline void Record(std::chrono::nanoseconds elapsed) {
+            Record(static_cast<uint64_t>(elapsed.count()));
+        }
+
+        HistogramSnapshot Snapshot() const;
+
+        static inline size_t BucketIndex(uint64_t value) {
+            if (value < SUB_BUCKETS) {
+                return static_cast<size_t>(value);
+            }
+            int exponent = 63 - __builtin_clzll(value);
+            if (exponent >= MAX_EXPONENT) {
+                return NUM_BUCKETS - 1;
+            }
+            uint64_t sub = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+            return static_cast<size_t>((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub);
+        }
+
+        // 버킷에 들어가는 가장 큰 값
+        static uint64_t BucketUpperBound(size_t index);
+
+    private:
+        struct alignas(CACHE_LINE_SIZE) Shard {
+            std::atomic<uint64_t> sum_{0};
+            std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};
+        };
+
+        // 샤드 하나가 수 KB라서 힙에 둠
+        Shard* shards_;
+    };
+
+    /**
+     * @brief 구간 실행 시간을 재서 히스토그램에 기록하는 RAII 헬퍼
+     */
+    class ScopedLatencyTimer {
+    public:
+        explicit ScopedLatencyTimer(LatencyHistogram& histogram)
+            : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+        ~ScopedLatencyTimer() {
+            histogram_.Record(std::chrono::steady_clock::now() - start_);
+        }
+
+        ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+        ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+
+    private:
+        LatencyHistogram& histogram_;
+        std::chrono::steady_clock::time_point start_;
+    };
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    enum class SortKeyType {
+        INT64, // 부호 있는 64비트 정수
+        BYTES  // key_length 바이트를 memcmp 순서로
+    };
+
+    // 튜플에서 정렬 키와 같이 내보낼 payload의 위치 (튜플 시작부터의 바이트 오프셋)
+    struct SortColumns {
+        size_t key_offset = 0;
+        SortKeyType key_type = SortKeyType::INT64;
+        size_t key_length = sizeof(int64_t); // BYTES일 때만 사용 (INT64는 항상 8)
+        bool descending = false;
+
+        size_t payload_offset = sizeof(int64_t);
+        size_t payload_length = sizeof(int64_t);
+    };
+
+    struct ExternalSortOptions {
+        // run 생성에 쓰는 메모리 (레코드 + 정렬 항목). 입력이 이보다 크면 정렬된 run을 임시 페이지로 내보냄
+        size_t memory_limit = 64 * 1024 * 1024;
+
+        // 한 번에 병합하는 run 수. 0이면 버퍼 풀 크기로 정함 (run마다 1~2페이지를 pin)
+        size_t max_fan_in = 0;
+
+        // 병합 중 run마다 다음 페이지를 백그라운드 스레드로 미리 pin
+        bool prefetch = true;
+    };
+
+    struct ExternalSortStats {
+        size_t input_rows = 0;
+        size_t runs = 0;          // 처음 만든 정렬 run 수 (메모리에 남긴 마지막 run 포함)
+        size_t merge_passes = 0;  // 중간 병합 횟수 (마지막 병합 제외)
+        size_t spilled_pages = 0; // 임시 페이지로 쓴 페이지 수 (중간 병합 결과 포함, 다 읽은 뒤 모두 반납됨)
+        size_t prefetch_waits = 0; // 프리페치가 늦어서 병합이 기다린 횟수
+        std::chrono::microseconds duration{0};
+    };
+
+    /**
+     * @brief ORDER BY / 인덱스 bulk build용 외부 병합 정렬
+     *
+     * 1. 입력을 memory_limit만큼씩 모아 정렬해서 run을 만듦. 키는 앞 8바이트를 부호 없는 정수 하나로 정규화한
+     *    prefix로 비교하고(INT64는 prefix가 키 전체), prefix가 같을 때만 나머지 키 바이트를 비교함.
+     *    정렬은 (prefix, 레코드 위치) 16바이트 항목 배열에서 하고, 레코드는 run을 쓸 때 한 번만 복사함
+     * 2. 다 찬 run은 BufferPoolManager의 임시 페이지(TempRun)로 내보내고, 마지막 run은 메모리에 남겨 병합에 바로 씀
+     * 3. run들을 loser tree로 k-way 병합. run이 max_fan_in보다 많으면 작은 run부터 묶어 중간 병합을 먼저 함.
+     *    병합 중에는 PagePrefetcher가 run마다 다음 페이지를 미리 읽어 둠
+     */
+    class ExternalSort {
+    public:
+        // 정렬 순서대로 행마다 한 번. key는 튜플의 원래 키 바이트, payload는 payload_length 바이트 (다음 호출 전까지만 유효)
+        using Emit = std::function<void(const char* key, const char* payload)>;
+
+        ExternalSort(BufferPoolManager* bpm, const ExternalSortOptions& options = {});
+
+        // @throws std::runtime_error 컬럼 정의가 잘못됐거나 튜플이 컬럼보다 짧을 때
+        ExternalSortStats Execute(const std::vector<PageId>& pages, const SortColumns& columns, const Emit& emit);
+
+    private:
+        BufferPoolManager* bpm_;
+        ExternalSortOptions options_;
+    };
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+
+namespace mydb {
+
+    // 튜플에서 읽을 int64 컬럼 위치 (튜플 시작부터의 바이트 오프셋)
+    struct KeyValueColumns {
+        size_t key_offset = 0;
+        size_t value_offset = sizeof(int64_t);
+    };
+
+    struct HashOperatorOptions {
+        // 파티션 버퍼가 쓸 수 있는 메모리. 넘으면 가장 큰 파티션부터 임시 페이지로 내보냄 (조인은 양쪽이 절반씩)
+        size_t memory_limit = 64 * 1024 * 1024;
+
+        // 파티션 비트 수. -1이면 파티션 하나의 해시 테이블이 partition_table_bytes에 들어가도록 입력 크기로 정함
+        int radix_bits = -1;
+
+        // 파티션 하나의 해시 테이블 목표 크기 (L2 캐시 정도)
+        size_t partition_table_bytes = 256 * 1024;
+    };
+
+    struct HashOperatorStats {
+        size_t input_rows = 0;    // 조인이면 build + probe
+        size_t output_rows = 0;
+        size_t partitions = 0;
+        size_t spilled_pages = 0; // 임시 페이지로 내보낸 페이지 수 (다 읽은 뒤 모두 반납됨)
+        std::chrono::microseconds duration{0};
+    };
+
+    struct AggregateRow {
+        int64_t key;
+        int64_t count;
+        int64_t sum;
+        int64_t min;
+        int64_t max;
+    };
+
+    /**
+     * @brief GROUP BY key + COUNT/SUM/MIN/MAX(value)
+     *
+     * 1. 입력 페이지를 스캔하면서 캐시 크기의 사전 집계 테이블에 먼저 모음. 테이블이 찬 뒤 새로 나온 키의 행만
+     *    해시 위쪽 비트로 radix 파티셔닝 (메모리를 넘으면 임시 페이지로 spill)
+     * 2. 파티션마다 flat open addressing 테이블(linear probing, 슬롯에 해시 저장)로 집계하고 그룹을 내보냄
+     * 파티션 하나의 테이블은 캐시에 들어가는 크기라서, 그룹 수가 많아도 집계 단계의 접근이 캐시 안에서 끝남
+     */
+    class HashAggregate {
+    public:
+        // 그룹마다 한 번. 사전 집계된 그룹 다음 파티션 순서대로 나오고, 그 안에서는 순서 없음
+        using Emit = std::function<void(const AggregateRow& row)>;
+
+        HashAggregate(BufferPoolManager* bpm, const HashOperatorOptions& options = {});
+
+        HashOperatorStats Execute(const std::vector<PageId>& pages, const KeyValueColumns& columns, const Emit& emit);
+
+    private:
+        BufferPoolManager* bpm_;
+        HashOperatorOptions options_;
+    };
+
+    /**
+     * @brief 내부 동등 조인 (build.key == probe.key)
+     *
+     * 양쪽을 같은 radix 비트로 파티셔닝한 뒤, 파티션마다 build 쪽으로 flat 테이블을 만들고 probe 쪽을 조회함 (radix hash join).
+     * 파티션 수는 build 쪽 테이블이 캐시에 들어가도록 build 입력 크기로 정함. 중복 키는 모든 쌍을 내보냄
+     */
+    class HashJoin {
+    public:
+        using Emit = std::function<void(int64_t key, int64_t build_value, int64_t probe_value)>;
+
+        HashJoin(BufferPoolManager* bpm, const HashOperatorOptions& options = {});
+
+        HashOperatorStats Execute(const std::vector<PageId>& build_pages, const KeyValueColumns& build_columns,
+                                  const std::vector<PageId>& probe_pages, const KeyValueColumns& probe_columns,
+                                  const Emit& emit);
+
+    private:
+        BufferPoolManager* bpm_;
+        HashOperatorOptions options_;
+    };
+}
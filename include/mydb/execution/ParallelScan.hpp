@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/common/Metrics.hpp"
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    struct ParallelScanOptions {
+        // 워커 수 (호출한 스레드 포함). 0이면 하드웨어 스레드 수
+        size_t num_threads = 0;
+
+        // morsel 하나의 페이지 수 (16 = 256KB). 작을수록 부하가 고르게 퍼지고, 클수록 deque 접근이 줄어듦
+        PageId morsel_pages = 16;
+    };
+
+    struct ParallelScanStats {
+        size_t pages_scanned = 0;
+        size_t morsels = 0;
+        size_t stolen_morsels = 0; // 다른 워커의 deque에서 가져온 morsel 수
+        std::chrono::microseconds duration{0};
+    };
+
+    /**
+     * @brief morsel 단위 병렬 테이블 스캔
+     *
+     * 페이지 목록을 morsel(연속된 페이지 몇 개)로 나누고, 워커마다 연속된 morsel 묶음을 자기 deque에 미리 나눠 줌.
+     * 워커는 자기 deque의 앞에서부터(페이지 순서대로) 꺼내고, 비면 다른 워커 deque의 뒤에서 훔쳐 옴.
+     * -> 평소에는 워커끼리 겹치지 않는 구간을 순서대로 읽고, 느린 워커가 있으면 남은 일이 자동으로 넘어감.
+     * 페이지는 한 번에 하나씩 BufferPoolManager로 pin해서 방문 (풀 크기는 워커 수 이상이어야 함)
+     */
+    class ParallelScan {
+    public:
+        // (워커 번호, pin된 페이지). 같은 워커 번호는 항상 한 스레드에서만 호출되므로 워커별 상태는 락 없이 써도 됨
+        using PageVisitor = std::function<void(size_t worker, const TablePage* page)>;
+
+        ParallelScan(BufferPoolManager* bpm, std::vector<PageId> pages, const ParallelScanOptions& options = {});
+
+        // next_page_id_ 체인을 따라가며 테이블의 페이지 목록을 만듦 (헤더만 읽음)
+        static std::vector<PageId> CollectPages(BufferPoolManager* bpm, PageId first_page_id);
+
+        /**
+         * @brief 모든 페이지를 워커들에게 나눠서 방문 (호출한 스레드도 워커 0으로 참여). 모두 끝나야 반환
+         * 페이지를 pin하지 못하면 (모든 프레임이 pin된 상태) runtime_error
+         */
+        ParallelScanStats Run(const PageVisitor& visitor);
+
+        /**
+         * @brief 워커마다 Local을 하나씩 두고 visit(local, page)로 채운 뒤, merge(result, local)로 합침
+         * 워커별 상태는 캐시 라인 단위로 떨어뜨려 둠 (카운터 같은 작은 상태가 false sharing 나지 않게)
+         */
+        template <typename Local, typename Visit, typename Merge>
+        Local Aggregate(Visit visit, Merge merge, ParallelScanStats* stats = nullptr) {
+            struct alignas(CACHE_LINE_SIZE) Slot {
+                Local local{};
+            };
+            std::vector<Slot> slots(num_threads_);
+            ParallelScanStats result_stats = Run([&](size_t worker, const TablePage* page) {
+                visit(slots[worker].local, page);
+            });
+            if (stats != nullptr) {
+                *stats = result_stats;
+            }
+
+            Local result = std::move(slots[0].local);
+            for (size_t i = 1; i < slots.size(); i++) {
+                merge(result, slots[i].local);
+            }
+            return result;
+        }
+
+        inline size_t get_num_threads() const { return num_threads_; }
+        inline size_t get_num_pages() const { return pages_.size(); }
+
+    private:
+        BufferPoolManager* bpm_;
+        std::vector<PageId> pages_;
+        size_t num_threads_;
+        PageId morsel_pages_;
+    };
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mydb/execution/TempRun.hpp"
+
+namespace mydb {
+
+    // 해시 연산자가 튜플에서 뽑아 쓰는 (키, 값) 한 쌍
+    struct HashEntry {
+        int64_t key;
+        int64_t value;
+    };
+
+    /**
+     * @brief 64비트 키 해시 (murmur3 finalizer)
+     * 파티션 번호는 위쪽 비트, 해시 테이블 슬롯은 아래쪽 비트를 쓰므로 둘이 서로 독립적.
+     * 0은 해시 테이블에서 "빈 슬롯"을 뜻하므로 내지 않음
+     */
+    inline uint64_t HashKey(int64_t key) {
+        auto h = static_cast<uint64_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h == 0 ? 1 : h;
+    }
+
+    /**
+     * @brief 해시 위쪽 비트로 entry를 2^radix_bits개 파티션에 나눔
+     * 파티션마다 메모리 버퍼에 모으다가, 전체가 memory_limit을 넘으면 가장 큰 파티션 버퍼를 임시 페이지(TempRun)로 내보냄.
+     * 파티션 하나씩 다시 꺼내서 처리하면, 파티션마다 만드는 해시 테이블이 캐시에 들어가는 크기로 유지됨
+     */
+    class RadixPartitioner {
+    public:
+        // 파티션 번호에 쓰는 해시 비트 위치 (HASH_SHIFT부터 radix_bits개)
+        static constexpr int HASH_SHIFT = 40;
+        static constexpr int MAX_RADIX_BITS = 16;
+
+        RadixPartitioner(BufferPoolManager* bpm, int radix_bits, size_t memory_limit);
+
+        // 꺼내지 않은 파티션의 임시 페이지를 반납
+        ~RadixPartitioner();
+
+        RadixPartitioner(const RadixPartitioner&) = delete;
+        RadixPartitioner& operator=(const RadixPartitioner&) = delete;
+
+        static inline size_t PartitionOf(uint64_t hash, size_t mask) {
+            return static_cast<size_t>(hash >> HASH_SHIFT) & mask;
+        }
+
+        inline void Add(uint64_t hash, const HashEntry& entry) {
+            partitions_[PartitionOf(hash, mask_)].buffer_.push_back(entry);
+            if (++buffered_ > max_buffered_) {
+                SpillLargest();
+            }
+        }
+
+        /**
+         * @brief 파티션 p의 entry를 모두 out에 담음 (spill된 것 먼저, 그다음 메모리 버퍼)
+         * 읽은 임시 페이지는 반납되고, 파티션은 빈 상태가 됨
+         */
+        void TakePartition(size_t p, std::vector<HashEntry>* out);
+
+        // 파티션 p를 읽지 않고 비움 (임시 페이지 반납)
+        void DropPartition(size_t p);
+
+        inline size_t get_num_partitions() const { return partitions_.size(); }
+
+        // 파티션 p의 entry 수 (spill된 것 포함)
+        size_t GetPartitionSize(size_t p) const;
+
+        inline size_t get_spilled_pages() const { return spilled_pages_; }
+
+        /**
+         * @brief 입력 크기에 맞는 파티션 비트 수
+         * 파티션 하나가 slot_bytes짜리 슬롯 테이블(부하율 1/2)로 만들어졌을 때 target_bytes 안에 들어가도록
+         */
+        static int ChooseRadixBits(size_t num_entries, size_t slot_bytes, size_t target_bytes);
+
+    private:
+        struct Partition {
+            std::vector<HashEntry> buffer_;
+            std::vector<TempRun> runs_;
+            size_t spilled_entries_ = 0;
+        };
+
+        void SpillLargest();
+
+        BufferPoolManager* bpm_;
+        std::vector<Partition> partitions_;
+        size_t mask_;
+
+        size_t buffered_ = 0;     // 모든 파티션 버퍼의 entry 수
+        size_t max_buffered_;     // memory_limit / sizeof(HashEntry)
+        size_t spilled_pages_ = 0;
+    };
+}
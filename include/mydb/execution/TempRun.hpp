@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/buffer/PagePrefetcher.hpp"
+
+namespace mydb {
+
+    /**
+     * @brief 임시 페이지에 순서대로 쓴 고정 크기 레코드 묶음 (spill, 정렬 run)
+     * 페이지는 BufferPoolManager::NewTempPage로 받아서, 메모리가 부족하면 다른 페이지처럼 쫓겨나며 디스크에 쓰이고
+     * 다시 읽을 때 FetchPage로 올라옴. 다 읽은 페이지는 DeleteTempPage로 반납 (임시 페이지 풀로 돌아가서 다음 임시 페이지가 재사용.
+     * 반납하기 전에 크래시가 나면 다음 시작 때 free list로 돌아감)
+     */
+    struct TempRun {
+        std::vector<PageId> pages;
+        size_t num_records = 0;
+    };
+
+    /**
+     * @brief 임시 페이지 레이아웃: [레코드 수 8][레코드 x N] (트레일러 앞까지)
+     */
+    struct TempPageLayout {
+        static constexpr size_t HEADER_SIZE = sizeof(uint64_t);
+
+        static constexpr size_t RecordsPerPage(size_t record_size) {
+            return (PAGE_TRAILER_OFFSET - HEADER_SIZE) / record_size;
+        }
+    };
+
+    /**
+     * @brief TempRun 쓰기. 지금 채우는 페이지 하나만 pin함
+     */
+    class TempRunWriter {
+    public:
+        TempRunWriter(BufferPoolManager* bpm, size_t record_size);
+
+        // Finish하지 않고 없어지면 쓴 페이지를 모두 반납
+        ~TempRunWriter();
+
+        TempRunWriter(const TempRunWriter&) = delete;
+        TempRunWriter& operator=(const TempRunWriter&) = delete;
+
+        inline void Append(const void* record) {
+            if (count_ == records_per_page_ || page_ == nullptr) {
+                NextPage();
+            }
+            std::memcpy(page_->get_data() + TempPageLayout::HEADER_SIZE + count_ * record_size_, record, record_size_);
+            count_++;
+            run_.num_records++;
+        }
+
+        // 여러 레코드를 한 번에 (페이지 경계에서만 나눠서 memcpy)
+        void AppendBatch(const void* records, size_t count);
+
+        // 마지막 페이지를 unpin하고 run을 넘김 (이후 Append 불가)
+        TempRun Finish();
+
+    private:
+        // 현재 페이지를 마무리(unpin, dirty)하고 새 페이지를 받음. 프레임이 없으면 runtime_error
+        void NextPage();
+
+        void SealPage();
+
+        BufferPoolManager* bpm_;
+        size_t record_size_;
+        size_t records_per_page_;
+
+        Page* page_ = nullptr;
+        PageId page_id_ = INVALID_PAGE_ID;
+        size_t count_ = 0; // 현재 페이지의 레코드 수
+
+        TempRun run_;
+        bool finished_ = false;
+    };
+
+    /**
+     * @brief TempRun 읽기 (한 번만 읽을 수 있음). 한 페이지씩 pin하고, 다 읽은 페이지는 반납
+     * prefetcher를 주면 지금 페이지를 읽는 동안 다음 페이지를 미리 pin해 둠 (reader 하나가 최대 2페이지를 pin)
+     */
+    class TempRunReader {
+    public:
+        TempRunReader(BufferPoolManager* bpm, TempRun run, size_t record_size, PagePrefetcher* prefetcher = nullptr);
+
+        // 다 읽지 않았어도 남은 페이지를 모두 반납
+        ~TempRunReader();
+
+        TempRunReader(const TempRunReader&) = delete;
+        TempRunReader& operator=(const TempRunReader&) = delete;
+
+        // 다음 레코드 (끝이면 nullptr). 포인터는 다음 Next 호출 전까지만 유효
+        inline const char* Next() {
+            if (index_ == count_ && !NextPage()) {
+                return nullptr;
+            }
+            return records_ + (index_++) * record_size_;
+        }
+
+        /**
+         * @brief 현재 페이지에 남은 레코드를 한꺼번에 (끝이면 0)
+         * records는 다음 NextBatch/Next 호출 전까지만 유효
+         */
+        size_t NextBatch(const char** records);
+
+        inline size_t get_num_records() const { return run_.num_records; }
+
+    private:
+        // 현재 페이지 반납 후 다음 페이지 pin. 없으면 false
+        bool NextPage();
+
+        void ReleasePage();
+
+        BufferPoolManager* bpm_;
+        TempRun run_;
+        size_t record_size_;
+
+        PagePrefetcher* prefetcher_;
+        PagePrefetcher::Handle pending_; // run_.pages[next_page_]에 대한 프리페치 요청 (없으면 비어 있음)
+
+        size_t next_page_ = 0; // 다음에 읽을 run_.pages 인덱스
+        PageId page_id_ = INVALID_PAGE_ID;
+        const char* records_ = nullptr;
+        size_t count_ = 0;
+        size_t index_ = 0;
+    };
+
+    // 읽지 않을 run의 페이지를 모두 반납
+    void FreeTempRun(BufferPoolManager* bpm, TempRun* run);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/recovery/LogManager.hpp"
+
+namespace mydb {
+
+    struct CheckpointOptions {
+        // 백그라운드 체크포인트 주기
+        std::chrono::milliseconds interval = std::chrono::seconds(30);
+
+        // 초당 최대 쓰기 페이지 수 (0이면 제한 없음). 한 번에 몰아서 쓰지 않도록 I/O를 분산
+        size_t max_pages_per_second = 0;
+
+        // DPT를 CHECKPOINT_DPT 레코드 하나에 담을 최대 페이지 수
+        size_t dpt_entries_per_record = 4096;
+    };
+
+    struct CheckpointStats {
+        Lsn checkpoint_lsn = INVALID_LSN;
+        size_t pages_written = 0;
+        size_t dirty_pages_recorded = 0;
+        std::chrono::microseconds duration{0};
+    };
+
+    /**
+     * @brief Fuzzy 체크포인트 (ARIES)
+     *
+     * 한 번의 체크포인트:
+     * 1. 지금 dirty인 페이지들을 WriteBackPage로 조금씩(속도 제한) 디스크에 씀. 포그라운드 트래픽은 멈추지 않음
+     * 2. CHECKPOINT_BEGIN -> CHECKPOINT_DPT(dirty page table) -> CHECKPOINT_END(활성 트랜잭션 테이블) 기록
+     * 3. 로그 파일 헤더에 CHECKPOINT_BEGIN 위치를 기록
+     *
+     * 복구는 헤더의 체크포인트부터 분석을 시작하고, redo는 DPT의 가장 작은 rec_lsn부터 하므로
+     * 재시작 시간이 전체 로그 길이가 아니라 마지막 체크포인트 이후의 작업량에 비례하게 된다.
+     */
+    class Checkpointer {
+    public:
+        Checkpointer(BufferPoolManager* bpm, LogManager* log_manager, CheckpointOptions options = {});
+
+        ~Checkpointer();
+
+        // 백그라운드 스레드 시작/종료
+        void Start();
+        void Stop();
+
+        // 체크포인트 한 번 실행 (호출한 스레드에서)
+        CheckpointStats Checkpoint();
+
+        CheckpointStats GetLastStats();
+
+    private:
+        void ThreadMain();
+
+        // 속도 제한에 맞춰 대기. 종료 요청이 오면 false
+        bool Throttle(std::chrono::steady_clock::time_point start, size_t pages_written);
+
+        BufferPoolManager* bpm_;
+        LogManager* log_manager_;
+        CheckpointOptions options_;
+
+        // 체크포인트는 한 번에 하나만
+        std::mutex checkpoint_mutex_;
+        std::unique_ptr<Page> scratch_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool running_ = false;
+        std::thread thread_;
+        CheckpointStats last_stats_;
+    };
+}
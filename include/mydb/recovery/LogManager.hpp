@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "mydb/recovery/LogRecord.hpp"
+#include "mydb/recovery/Transaction.hpp"
+#include "mydb/storage/DiskManager.hpp"
+
+namespace mydb {
+
+    // 로그 버퍼 기본 크기 (버퍼 2개를 번갈아 사용)
+    constexpr size_t LOG_BUFFER_SIZE = 1 << 20; // 1MB
+
+    /**
+     * @brief Write-Ahead Log 관리
+     *
+     * 레코드는 메모리의 로그 버퍼에 이어 붙이기만 하고(Append), 디스크 기록은 백그라운드 flush 스레드가 한다.
+     * - 버퍼 2개(log_buffer_, flush_buffer_)를 교대로 써서, flush 중에도 다른 스레드가 계속 Append 가능
+     * - 여러 스레드의 Commit이 한 번의 fdatasync로 같이 영속화됨 (group commit)
+     *   : fsync 하는 동안 들어온 커밋들이 다음 배치에 모여서 한 번에 처리된다
+     */
+    class LogManager {
+    public:
+        /**
+         * @param flush_interval 요청이 없어도 이 주기마다 버퍼를 비움
+         */
+        explicit LogManager(DiskManager* disk_manager,
+                            size_t buffer_size = LOG_BUFFER_SIZE,
+                            std::chrono::microseconds flush_interval = std::chrono::milliseconds(10));
+
+        // flush 스레드 종료 + 남은 버퍼 기록
+        ~LogManager();
+
+        /**
+         * @brief 레코드를 로그 버퍼에 추가하고 LSN을 부여
+         * txn이 있으면 txn_id, prev_lsn을 채우고 txn의 prev_lsn을 갱신함
+         * @return 부여된 LSN
+         */
+        Lsn AppendLogRecord(LogRecord* record, Transaction* txn = nullptr);
+
+        /**
+         * @brief lsn까지의 로그가 디스크에 영속화될 때까지 대기
+         * (BufferPoolManager가 dirty 페이지를 쓰기 전에 호출: WAL-before-data)
+         */
+        void Flush(Lsn lsn);
+
+        // 지금까지 Append된 모든 로그를 영속화
+        void FlushAll();
+
+        // 트랜잭션 시작 (BEGIN 기록)
+        Transaction Begin();
+
+        // COMMIT 기록 후, 영속화될 때까지 대기 (group commit)
+        void Commit(Transaction* txn);
+
+        // 이 LSN보다 작은 레코드는 전부 디스크에 있음
+        inline Lsn GetPersistentLsn() const { return persistent_lsn_.load(std::memory_order_acquire); }
+
+        // 다음에 Append될 레코드가 받을 LSN (= 현재 로그의 끝). 락 없이 읽으므로 버퍼 풀 hot path에서도 사용 가능
+        inline Lsn GetNextLsn() const { return next_lsn_.load(std::memory_order_acquire); }
+
+        // 커밋/롤백되지 않은 트랜잭션 목록 (txn_id -> 마지막 LSN). 체크포인트에 기록됨
+        std::vector<std::pair<TxnId, Lsn>> GetActiveTxns();
+
+        inline TxnId GetNextTxnId() const { return next_txn_id_.load(); }
+
+        // 마지막으로 완료된 체크포인트 (로그 파일 헤더에 기록된 master record)
+        inline Lsn GetCheckpointLsn() const { return checkpoint_lsn_.load(); }
+
+        // 로그 파일 헤더의 체크포인트 위치를 갱신하고 영속화
+        void SetCheckpointLsn(Lsn lsn);
+
+        /**
+         * @brief 복구가 끝난 뒤 상태 보정
+         * @param log_end 유효한 로그의 끝 (그 뒤는 잘라냄)
+         * @param next_txn_id 다음에 발급할 트랜잭션 ID
+         */
+        void ResetAfterRecovery(Lsn log_end, TxnId next_txn_id);
+
+        inline DiskManager* get_disk_manager() { return disk_manager_; }
+
+    private:
+        void FlushThreadMain();
+
+        DiskManager* disk_manager_;
+
+        size_t buffer_size_;
+        std::chrono::microseconds flush_interval_;
+
+        // latch_가 보호하는 영역
+        std::mutex latch_;
+        std::vector<char> log_buffer_;   // Append 대상
+        std::vector<char> flush_buffer_; // flush 스레드가 디스크에 쓰는 중인 버퍼
+        size_t log_buffer_used_ = 0;
+        Lsn buffer_start_lsn_;           // log_buffer_[0]이 가질 LSN(파일 위치)
+        std::atomic<Lsn> next_lsn_;      // 쓰기는 latch_ 안에서만. 읽기는 락 없이 가능(GetNextLsn)
+        bool flush_requested_ = false;
+        bool flushing_ = false;
+        bool running_ = true;
+
+        std::condition_variable flush_cv_;   // flush 스레드 깨우기
+        std::condition_variable append_cv_;  // 버퍼 공간이 생김
+        std::condition_variable persist_cv_; // persistent_lsn_ 증가
+
+        // 활성 트랜잭션 테이블 (latch_가 보호)
+        std::unordered_map<TxnId, Lsn> active_txns_;
+
+        std::atomic<Lsn> persistent_lsn_;
+        std::atomic<Lsn> checkpoint_lsn_{INVALID_LSN};
+        std::atomic<TxnId> next_txn_id_{1};
+
+        std::thread flush_thread_;
+    };
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mydb/recovery/Transaction.hpp"
+#include "mydb/storage/Page.hpp"
+#include "mydb/storage/Tuple.hpp"
+
+namespace mydb {
+
+    enum class LogRecordType : uint8_t {
+        INVALID = 0,
+        BEGIN,
+        COMMIT,
+        ABORT,          // 복구 중 undo가 끝난 트랜잭션에 남김
+        INIT_PAGE,      // TablePage::Init
+        INSERT,         // TablePage::InsertTuple
+        MARK_DELETE,    // TablePage::MarkDelete
+        CLR,            // Compensation Log Record: undo 한 작업의 기록 (redo만 되고 다시 undo되지 않음)
+        CHECKPOINT_BEGIN,
+        CHECKPOINT_DPT, // dirty page table 일부 (페이지 수가 많으면 여러 레코드로 나눠서 기록)
+        CHECKPOINT_END, // 활성 트랜잭션 테이블
+    };
+
+    /**
+     * @brief WAL 레코드 하나
+     *
+     * 디스크 포맷: [헤더 32B][타입별 본문]
+     *   헤더 = size(4) | checksum(4) | lsn(8) | prev_lsn(8) | txn_id(4) | type(1) | padding(3)
+     * checksum은 checksum 필드를 뺀 레코드 전체에 대한 CRC32C
+     * (크래시로 로그 꼬리가 반쯤만 쓰였으면 여기서 걸러진다)
+     */
+    struct LogRecord {
+        static constexpr size_t HEADER_SIZE = 32;
+
+        uint32_t size_ = 0;                  // 직렬화된 전체 크기 (헤더 포함)
+        Lsn lsn_ = INVALID_LSN;
+        Lsn prev_lsn_ = INVALID_LSN;         // 같은 트랜잭션의 직전 레코드
+        TxnId txn_id_ = INVALID_TXN_ID;
+        LogRecordType type_ = LogRecordType::INVALID;
+
+        // [INIT_PAGE, INSERT, MARK_DELETE, CLR]
+        PageId page_id_ = INVALID_PAGE_ID;
+
+        // [INIT_PAGE]
+        PageId prev_page_id_ = INVALID_PAGE_ID;
+        PageId next_page_id_ = INVALID_PAGE_ID;
+
+        // [INSERT, MARK_DELETE, CLR]
+        uint16_t slot_id_ = 0;
+
+        // [MARK_DELETE, CLR] 삭제 전 슬롯 정보 (undo 시 슬롯을 되살리는 데 필요)
+        uint16_t slot_offset_ = 0;
+        uint16_t slot_length_ = 0;
+
+        // [INSERT]
+        Tuple tuple_;
+
+        // [CLR] 되돌린 레코드의 타입, 그 트랜잭션에서 다음에 undo할 레코드
+        LogRecordType undone_type_ = LogRecordType::INVALID;
+        Lsn undo_next_lsn_ = INVALID_LSN;
+
+        // [CHECKPOINT_DPT] (page_id, rec_lsn)
+        std::vector<std::pair<PageId, Lsn>> dirty_pages_;
+
+        // [CHECKPOINT_END] (txn_id, last_lsn), 다음 트랜잭션 ID
+        std::vector<std::pair<TxnId, Lsn>> active_txns_;
+        TxnId next_txn_id_ = INVALID_TXN_ID;
+
+        // 팩토리 (size_는 여기서 계산됨, lsn/prev_lsn/txn_id는 LogManager가 채움)
+        static LogRecord MakeTxnRecord(LogRecordType type);
+        static LogRecord MakeInitPage(PageId page_id, PageId prev_page_id, PageId next_page_id);
+        static LogRecord MakeInsert(PageId page_id, uint16_t slot_id, const Tuple& tuple);
+        static LogRecord MakeMarkDelete(PageId page_id, uint16_t slot_id, uint16_t slot_offset, uint16_t slot_length);
+        static LogRecord MakeCompensation(const LogRecord& undone, Lsn undo_next_lsn);
+        static LogRecord MakeCheckpointDpt(std::vector<std::pair<PageId, Lsn>> dirty_pages);
+        static LogRecord MakeCheckpointEnd(std::vector<std::pair<TxnId, Lsn>> active_txns, TxnId next_txn_id);
+
+        // buf에 size_ 바이트만큼 기록
+        void SerializeTo(char* buf) const;
+
+        /**
+         * @brief buf에서 레코드 하나를 읽음
+         * @param available buf에서 읽을 수 있는 바이트 수
+         * @return 완전하고 체크섬이 맞는 레코드면 true (false면 로그의 유효한 끝으로 간주)
+         */
+        static bool Deserialize(const char* buf, size_t available, LogRecord* record);
+
+        // 헤더만 보고 레코드 전체 크기를 알아냄 (유효하지 않으면 0)
+        static uint32_t PeekSize(const char* buf, size_t available);
+
+        std::string ToString() const;
+
+    private:
+        void ComputeSize();
+    };
+
+    /**
+     * @brief 로그 파일 맨 앞의 헤더
+     * LSN이 0이 되지 않게 해주고(INVALID_LSN), 파일이 우리 로그 파일이 맞는지 확인하는 용도
+     */
+    struct LogFileHeader {
+        static constexpr uint32_t MAGIC = 0x4C42444D; // "MDBL"
+        static constexpr uint32_t VERSION = 1;
+
+        uint32_t magic_ = MAGIC;
+        uint32_t version_ = VERSION;
+        Lsn checkpoint_lsn_ = INVALID_LSN; // 마지막 체크포인트의 CHECKPOINT_BEGIN 위치 (복구 시작점)
+    };
+
+    constexpr size_t LOG_HEADER_SIZE = sizeof(LogFileHeader);
+}
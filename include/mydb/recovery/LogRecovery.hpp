@@ -0,0 +1,72 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/recovery/LogManager.hpp"
+#include "mydb/recovery/LogRecord.hpp"
+#include "mydb/storage/DiskManager.hpp"
+
+namespace mydb {
+
+    /**
+     * @brief 시작 시 WAL을 읽어서 DB를 일관된 상태로 되돌림 (ARIES 방식)
+     *
+     * 1. Analysis: 마지막 체크포인트부터 로그를 끝까지 훑어서 유효한 로그의 끝, loser 트랜잭션, dirty page table을 구함
+     * 2. Redo: DPT의 가장 작은 rec_lsn부터 페이지 변경을 다시 적용 (페이지 LSN >= 레코드 LSN이면 이미 반영된 것이므로 건너뜀)
+     * 3. Undo: 모든 loser 트랜잭션의 변경을 합쳐서 LSN이 큰 것부터(각자 prev_lsn 체인을 따라) 되돌리고, 되돌린 작업마다 CLR을 남김
+     *    (undo 도중 다시 크래시가 나도, CLR의 undo_next_lsn_ 덕분에 같은 작업을 두 번 되돌리지 않음)
+     *
+     * LogManager, BufferPoolManager를 만든 직후, 다른 작업을 시작하기 전에 한 번 호출해야 함
+     */
+    class LogRecovery {
+    public:
+        LogRecovery(DiskManager* disk_manager, BufferPoolManager* bpm, LogManager* log_manager);
+
+        void Recover();
+
+        // 마지막 Recover()에서 되돌린 loser 트랜잭션 수
+        inline size_t get_num_undone_txns() const { return num_undone_txns_; }
+        inline size_t get_num_redone_records() const { return num_redone_records_; }
+
+        // 마지막 Recover()에서 redo를 시작한 위치
+        inline Lsn get_redo_start_lsn() const { return redo_start_lsn_; }
+
+    private:
+        // lsn 위치의 레코드를 읽음 (유효하지 않으면 false)
+        bool ReadRecord(Lsn lsn, LogRecord* record);
+
+        void Analyze();
+        void Redo();
+        void Undo();
+
+        // 레코드의 페이지 변경을 페이지에 적용 (redo, CLR 공통)
+        void ApplyRedo(const LogRecord& record);
+
+        // redo 대상 페이지가 파일에 아직 없으면 파일을 늘림
+        void EnsurePageExists(PageId page_id);
+
+        DiskManager* disk_manager_;
+        BufferPoolManager* bpm_;
+        LogManager* log_manager_;
+
+        // 로그를 큰 단위로 읽어두는 버퍼 (read_buffer_[0]의 로그 파일 위치 = read_buffer_start_)
+        std::vector<char> read_buffer_;
+        Lsn read_buffer_start_ = INVALID_LSN;
+        size_t read_buffer_size_ = 0;
+
+        Lsn log_end_ = INVALID_LSN;
+
+        // loser 후보: txn_id -> 마지막 레코드 LSN
+        std::unordered_map<TxnId, Lsn> active_txns_;
+
+        // dirty page table: page_id -> rec_lsn (체크포인트의 DPT + 체크포인트 이후 수정된 페이지)
+        std::unordered_map<PageId, Lsn> dirty_pages_;
+        Lsn redo_start_lsn_ = INVALID_LSN;
+        TxnId max_txn_id_ = INVALID_TXN_ID;
+
+        size_t num_undone_txns_ = 0;
+        size_t num_redone_records_ = 0;
+    };
+}
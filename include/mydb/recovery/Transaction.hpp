@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include "mydb/storage/Page.hpp"
+
+namespace mydb {
+
+    using TxnId = uint32_t;
+
+    constexpr TxnId INVALID_TXN_ID = 0;
+
+    /**
+     * @brief 로그 기록 단위가 되는 트랜잭션
+     * 지금은 락/격리 없이, WAL 레코드를 한 줄로 엮는(prev_lsn 체인) 용도로만 사용
+     */
+    class Transaction {
+    public:
+        explicit Transaction(TxnId txn_id) : txn_id_(txn_id) {}
+
+        inline TxnId get_txn_id() const { return txn_id_; }
+
+        // 이 트랜잭션이 마지막으로 남긴 로그 레코드 (undo 시 이 체인을 거꾸로 따라감)
+        inline Lsn get_prev_lsn() const { return prev_lsn_; }
+        inline void set_prev_lsn(Lsn lsn) { prev_lsn_ = lsn; }
+
+    private:
+        TxnId txn_id_;
+        Lsn prev_lsn_ = INVALID_LSN;
+    };
+}
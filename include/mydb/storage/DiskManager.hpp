@@ -1,41 +1,199 @@
 #pragma once // 중복 포함 방지
 
 #include <string>
-#include <fstream>
 #include <mutex> // 스레드 동기화
+#include <stdexcept>
+#include "mydb/common/Metrics.hpp"
 #include "mydb/storage/Page.hpp"
+#include "mydb/storage/PageAllocator.hpp"
+#include "mydb/storage/Tablespace.hpp"
+#include "mydb/storage/TempPagePool.hpp"
 
 namespace mydb {
+
+    /**
+     * @brief 디스크에서 읽은 페이지의 체크섬이 맞지 않을 때 던지는 예외
+     * (torn write, 비트 손상 등으로 데이터를 믿을 수 없는 상태)
+     */
+    class PageCorruptionError : public std::runtime_error {
+    public:
+        PageCorruptionError(PageId page_id, uint32_t stored, uint32_t computed);
+
+        inline PageId get_page_id() const { return page_id_; }
+
+    private:
+        PageId page_id_;
+    };
+    // 읽기 전용 매핑의 접근 패턴 힌트 (madvise)
+    enum class AccessPattern {
+        NORMAL,
+        SEQUENTIAL, // 풀 스캔: 커널이 앞쪽을 크게 미리 읽고, 읽은 뒤쪽은 빨리 버림
+        RANDOM,     // 점 조회: 미리 읽기를 끔 (필요 없는 이웃 페이지로 캐시를 채우지 않게)
+    };
+
+    // 페이지 I/O 지표 (항상 켜져 있음. 기록 비용은 호출당 atomic add 몇 번)
+    struct DiskMetrics {
+        ShardedCounter pages_read;
+        ShardedCounter pages_written;
+        LatencyHistogram read_latency;  // ReadPage 전체 (락 대기 + 읽기 + 체크섬 검증)
+        LatencyHistogram batch_read_latency; // ReadPages 한 번 (여러 페이지를 한 번에 읽으므로 read_latency와 따로)
+        LatencyHistogram write_latency; // WritePage 전체 (락 대기 + 체크섬 계산 + 쓰기)
+    };
+
     /**
      * 디스크상의 파일에 Page read/write
+     * 페이지가 실제로 어느 파일의 어디에 있는지는 Tablespace가 결정 (기본은 DB 파일 하나)
      */
     class DiskManager {
     public:
         // 생성자: DB파일 열기
-        // db_file: 파일 경로
-        explicit DiskManager(const std::string& db_file);
+        // db_file: 파일 경로 (로그 파일 등 부속 파일 이름의 기준이기도 함)
+        // options: 데이터 파일을 여러 개로 나눌 때 (기본은 db_file 하나), 읽기 전용으로 열 때
+        explicit DiskManager(const std::string& db_file, const TablespaceOptions& options = {});
 
         // 소멸자: 파일 닫기
         ~DiskManager();
 
         // 특정 페이지 ID의 데이터를 읽어서 page객체에 적재
+        // 체크섬이 맞지 않으면 PageCorruptionError를 던짐
         void ReadPage(PageId page_id, Page& page);
 
+        /**
+         * @brief [first, first + count) 페이지를 한 번의 순차 읽기로 data에 읽음 (재시작 후 워밍업 같은 일괄 적재용)
+         * 체크섬 검증은 하지 않음 (호출한 쪽에서 페이지별로 VerifyChecksum)
+         * @return 실제로 읽은 페이지 수 (파일 끝을 넘는 부분은 잘림)
+         */
+        PageId ReadPages(PageId first, PageId count, char* data);
+
         // page객체의 데이터를 디스크의 해당 ID 위치에 write
+        // 트레일러의 체크섬은 여기서 계산해서 같이 기록함
         void WritePage(PageId page_id, const Page& page);
 
-        // 현재 파일 크기를 기준으로, 다음에 할당할 Page ID를 반환
+        /**
+         * @brief 페이지 체크섬 계산 (트레일러의 checksum 필드를 제외한 전체 영역)
+         * 다른 위치에 잘못 쓰인 페이지(misdirected write)도 잡기 위해 page_id(8바이트 전체)를 시드로 섞는다.
+         */
+        static uint32_t ComputeChecksum(PageId page_id, const char* data);
+
+        /**
+         * @brief 페이지 데이터의 체크섬 검증 (ReadPage, 읽기 전용 매핑 공통)
+         * 아직 한 번도 안 쓴(전부 0인) 페이지는 정상으로 취급
+         * @throws PageCorruptionError
+         */
+        static void VerifyChecksum(PageId page_id, const char* data);
+
+        // 새 페이지 ID 할당 (해제된 페이지가 있으면 재사용). 여러 스레드가 동시에 호출해도 됨
+        // 읽기 전용이면 std::runtime_error
         PageId AllocatePage();
 
-        // 파일 닫기 (소멸자에서 호출되지만, 명시적으로 닫기도 가능)
+        // 더 이상 쓰지 않는 페이지를 반납 (이후 AllocatePage가 다시 내줄 수 있음)
+        // 할당된 적 없거나 이미 반납된 페이지, 읽기 전용이면 false
+        bool DeallocatePage(PageId page_id);
+
+        // 임시 페이지(정렬 run, 해시 spill) ID 할당. 크래시로 반납하지 못한 임시 페이지는 다음 시작 때 free list로 돌아감
+        // 읽기 전용이면 std::runtime_error
+        PageId AllocateTempPage();
+
+        // 임시 페이지 반납 (임시 페이지끼리만 재사용). AllocateTempPage로 받은 적 없거나 이미 반납됐으면 false
+        bool DeallocateTempPage(PageId page_id);
+
+        // page_id까지 파일을 늘리고 high-water mark를 page_id + 1 이상으로 (free list에서 꺼내지 않음. 복구용)
+        // 읽기 전용이면 std::runtime_error
+        void ExtendToPage(PageId page_id);
+
+        // 지금까지 할당된 페이지 수 (high-water mark. 해제된 페이지 포함)
+        PageId GetNumPages();
+
+        // 파일 닫기 (소멸자에서 호출되지만, 명시적으로 닫기도 가능). free list를 .fsm 파일에 저장 (읽기 전용이면 닫기만)
         void ShutDown();
 
+        /*
+         * [로그 파일] WAL용. DB 파일과 같은 경로에 확장자만 .log로 바꾼 파일을 사용
+         * fsync가 필요해서 fstream 대신 POSIX 파일 디스크립터로 다룸.
+         * 처음 사용될 때 열린다 (로그를 안 쓰면 파일도 안 생김)
+         */
+
+        // 로그 파일의 offset 위치에 data를 씀 (fsync는 하지 않음)
+        void WriteLog(const char* data, size_t size, size_t offset);
+
+        // 로그 파일의 offset 위치부터 최대 size 바이트를 읽음. 실제로 읽은 바이트 수 반환
+        size_t ReadLog(char* data, size_t size, size_t offset);
+
+        // 지금까지 쓴 로그를 디스크에 영속화 (fdatasync)
+        void SyncLog();
+
+        size_t GetLogSize();
+
+        // 로그 파일을 size 바이트로 자름 (복구 시 깨진 꼬리 제거용)
+        void TruncateLog(size_t size);
+
+        inline bool is_read_only() const { return tablespace_.is_read_only(); }
+
+        inline const std::string& get_file_name() const { return file_name_; }
+        inline const std::string& get_log_file_name() const { return log_name_; }
+
+        inline const DiskMetrics& get_metrics() const { return metrics_; }
+
+        inline const Tablespace& get_tablespace() const { return tablespace_; }
+
+        inline const PageAllocator& get_allocator() const { return allocator_; }
+
+        inline const TempPagePool& get_temp_pages() const { return temp_pages_; }
+
+        inline bool IsTempPage(PageId page_id) const { return temp_pages_.IsTempPage(page_id); }
+
+        /*
+         * [읽기 전용 매핑] 읽기 전용 복제본, 분석용 스냅샷에서 페이지를 커널 -> 프레임으로 복사하지 않고
+         * 페이지 캐시를 그대로 보도록 DB 파일 전체를 mmap함. 매핑 이후에 늘어난 페이지는 보이지 않음
+         * (매핑이 있는 동안 이 파일에 WritePage/AllocatePage를 하면 안 됨. 데이터 파일이 하나일 때만 가능)
+         */
+
+        // 파일 전체를 PROT_READ로 매핑. 매핑된 페이지 수 반환
+        PageId MapFile(AccessPattern pattern = AccessPattern::RANDOM);
+
+        void UnmapFile();
+
+        // 매핑 안의 페이지 시작 주소 (범위 밖이면 nullptr). 체크섬 검증은 하지 않음
+        inline const char* GetMappedPage(PageId page_id) const {
+            if (mapping_ == nullptr || page_id >= num_mapped_pages_) {
+                return nullptr;
+            }
+            return mapping_ + static_cast<size_t>(page_id) * PAGE_SIZE;
+        }
+
+        inline PageId get_num_mapped_pages() const { return num_mapped_pages_; }
+
+        /**
+         * @brief [first, first + count) 범위에 접근 패턴 힌트 지정 (count = 0이면 매핑 전체)
+         * 스캔을 시작할 때 SEQUENTIAL, 끝나면 RANDOM으로 되돌리는 식으로 사용
+         */
+        void AdviseMapping(AccessPattern pattern, PageId first = 0, PageId count = 0);
+
+        // 곧 읽을 범위를 미리 페이지 캐시에 올리도록 요청 (MADV_WILLNEED, 기다리지 않음)
+        void PrefetchMapping(PageId first, PageId count);
+
     private:
+        // log_io_mutex_를 잡은 상태에서 호출
+        void OpenLogIfNeeded();
+
         std::string file_name_;
-        std::fstream db_io_; // 파일 입출력용 통로(?) 자바의 입출력 Stream처럼
+        std::string log_name_;
+        int log_fd_ = -1;
+        std::mutex log_io_mutex_;
+
+        // 데이터 파일들 (파일마다 fd를 따로 두고 pread/pwrite. 페이지 I/O에 공유 락 없음)
+        Tablespace tablespace_;
+
+        // 페이지 ID 할당/반납. free list는 DB 파일과 같은 경로의 .fsm 파일에 저장
+        PageAllocator allocator_;
+
+        // 임시 페이지 ID 풀. 받은 ID는 .spill 파일에 기록됨
+        TempPagePool temp_pages_;
+        bool shut_down_ = false;
+
+        char* mapping_ = nullptr;
+        PageId num_mapped_pages_ = 0;
 
-        // 동시성 제어용 Lock 객체
-        // 여러 스레드의 동시 write 방지
-        std::mutex db_io_mutex_;
+        DiskMetrics metrics_;
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <string>
@@ -10,15 +11,48 @@ namespace mydb {
     // MySQL 호환 페이지 크기: 16KB
     constexpr size_t PAGE_SIZE = 16384;
 
-    // 페이지 ID 타입 정의: 4바이트 정수(unsigned)
-    using PageId = uint32_t;
+    // 페이지 ID 타입 정의: 8바이트 정수(unsigned)
+    // 테이블스페이스 전체에서의 논리 페이지 주소. 어느 데이터 파일의 어느 위치인지는 Tablespace가 계산
+    // (4바이트면 16KB 페이지 기준 64TB가 한계)
+    using PageId = uint64_t;
 
     // 유효하지 않은 페이지 ID 상수
-    constexpr PageId INVALID_PAGE_ID = UINT32_MAX;
+    constexpr PageId INVALID_PAGE_ID = UINT64_MAX;
+
+    // 로그 레코드 번호(Log Sequence Number) = 로그 파일 내 레코드 시작 위치(byte offset)
+    using Lsn = uint64_t;
+
+    // 로그 파일 맨 앞은 헤더이므로, 0은 실제 레코드의 LSN이 될 수 없음
+    constexpr Lsn INVALID_LSN = 0;
+
+    /**
+     * @brief 모든 페이지의 맨 끝에 붙는 트레일러
+     * 디스크에 쓸 때 DiskManager가 체크섬을 채우고, 읽을 때 검증한다.
+     * (torn write, 비트 손상 감지용)
+     */
+    struct PageTrailer {
+        Lsn page_lsn_;       // 이 페이지에 마지막으로 반영된 로그 레코드의 LSN (WAL, 복구용)
+        PageId page_id_;     // 이 페이지의 ID (버퍼 풀이 적재할 때 채움)
+        uint32_t reserved_;
+        uint32_t checksum_;  // CRC32C (트레일러의 checksum_ 필드 직전까지의 바이트 대상)
+    };
+
+    // 체크섬은 항상 페이지의 마지막 4바이트 (PAGE_CHECKSUM_OFFSET)
+    static_assert(sizeof(PageTrailer) == 24 && offsetof(PageTrailer, checksum_) == sizeof(PageTrailer) - sizeof(uint32_t));
+
+    constexpr size_t PAGE_TRAILER_SIZE = sizeof(PageTrailer);
+
+    // 트레일러 시작 위치 = 페이지에서 실제 데이터로 쓸 수 있는 영역의 끝
+    constexpr size_t PAGE_TRAILER_OFFSET = PAGE_SIZE - PAGE_TRAILER_SIZE;
+
+    // 체크섬 필드 위치 (체크섬 계산 범위의 끝)
+    constexpr size_t PAGE_CHECKSUM_OFFSET = PAGE_SIZE - sizeof(uint32_t);
 
     /**
      * @brief DB의 가장 기본 저장 단위
      * 디스크상의 16KB 블록 하나와 1:1 매핑
+     * pin count, dirty 여부 같은 버퍼 풀 메타데이터는 BufferPoolManager의 FrameMeta 배열에 따로 둠
+     * (프레임 배열 = 순수 16KB 데이터의 연속, 메타데이터 스캔이 페이지 데이터를 건드리지 않게)
      */
     class Page {
     public:
@@ -28,9 +62,7 @@ namespace mydb {
         // 페이지 데이터를 0으로 초기화
         void reset() {
             data_.fill(0);
-            page_id_ = INVALID_PAGE_ID;
-            is_dirty_ = false;
-            pin_count_ = 0;
+            get_trailer()->page_id_ = INVALID_PAGE_ID;
         }
 
         // getter
@@ -41,27 +73,36 @@ namespace mydb {
             return reinterpret_cast<const char*>(data_.data());
         }
 
+        inline PageTrailer* get_trailer() {
+            return reinterpret_cast<PageTrailer*>(data_.data() + PAGE_TRAILER_OFFSET);
+        }
+        inline const PageTrailer* get_trailer() const {
+            return reinterpret_cast<const PageTrailer*>(data_.data() + PAGE_TRAILER_OFFSET);
+        }
+
         inline PageId get_page_id() const {
-            return page_id_;
+            return get_trailer()->page_id_;
         }
 
-        // 나중에 Buffer Manager에서 사용할 메타데이터 Getter/Setter
-        inline int get_pin_count() const {return pin_count_;}
-        inline bool is_dirty() const { return is_dirty_;}
+        // 페이지 LSN (트레일러에 저장되므로 디스크에도 같이 기록됨)
+        inline Lsn get_lsn() const { return get_trailer()->page_lsn_; }
+        inline void set_lsn(Lsn lsn) { get_trailer()->page_lsn_ = lsn; }
 
     private:
+        // 버퍼 풀 프레임용: 데이터를 건드리지 않는 생성자 (mmap한 메모리가 첫 접근 전까지 fault되지 않게)
+        struct UninitializedTag {};
+        explicit Page(UninitializedTag) {}
+
+        inline void set_page_id(PageId page_id) { get_trailer()->page_id_ = page_id; }
+
         // 실제 16KB 데이터가 저장되는 공간
         // alignas: 메모리 정렬 최적화(CPU 캐시 히트율 증가)
         alignas(16) std::array<uint8_t, PAGE_SIZE> data_;
 
-        // 메모리 상에서만 관리되는 메타데이터
-        PageId page_id_ = INVALID_PAGE_ID;
-        int pin_count_ = 0; // 현재 이 페이지를 보고 있는 스레드 수(atomic인듯)
-        bool is_dirty_ = false; // (마지막 디스크에서 쓴/읽은 시점 이후) 데이터 변경 여부. (true면 디스크에 다시 써야함)
-
-        // BufferPoolManager가 이 private 멤버들을 관리할 수 있게 허용
+        // BufferPoolManager가 프레임을 만들고 페이지 ID를 채울 수 있게 허용
         friend class BufferPoolManager;
-        // [추가] SlottedPage 구현 시
-        friend class TablePage;
     };
-}
\ No newline at end of file
+
+    // 프레임 배열을 PAGE_SIZE 간격으로 그대로 깔기 위해 (huge page 경계에 맞춰 정렬됨)
+    static_assert(sizeof(Page) == PAGE_SIZE);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mydb/common/Metrics.hpp"
+#include "mydb/storage/Tablespace.hpp"
+
+namespace mydb {
+
+    // 페이지 할당 지표
+    struct PageAllocatorMetrics {
+        ShardedCounter allocated; // 새로 늘린 페이지 (high-water mark 증가)
+        ShardedCounter reused;    // 해제된 페이지를 다시 내준 수
+        ShardedCounter freed;
+    };
+
+    /**
+     * @brief 페이지 ID 할당기
+     *
+     * 해제된 페이지는 (page_id % 샤드 수) 샤드의 free list에 들어가고, 샤드마다 free 비트맵으로 지금 free인 페이지를
+     * 기록함 -> 같은 페이지를 두 번 해제하면 거부 (두 번 들어가면 이후 같은 ID를 두 소유자에게 내주게 됨).
+     * 할당은 스레드마다 자기 샤드(CurrentMetricsShard)부터 보므로 여러 스레드가 동시에 할당/해제해도 같은 락을 잡는
+     * 일이 거의 없음. 자기 샤드가 비면 다른 샤드에서 가져오고, 전부 비어 있으면 Tablespace의 high-water mark를
+     * atomic으로 늘림 (free list가 비어 있는 동안은 락 없음)
+     *
+     * free list는 정상 종료(Save) 때 <DB 파일>.fsm에 저장되고, 다음에 열 때 읽은 뒤 바로 지움.
+     * 크래시로 파일이 없으면 free list 없이 시작함 -> 그 사이 해제된 페이지는 재사용되지 않지만(누수),
+     * 저장 이후에 다시 내준 페이지를 한 번 더 내주는 일은 생기지 않음
+     */
+    class PageAllocator {
+    public:
+        PageAllocator(Tablespace* tablespace, std::string fsm_path);
+
+        PageAllocator(const PageAllocator&) = delete;
+        PageAllocator& operator=(const PageAllocator&) = delete;
+
+        PageId Allocate();
+
+        /**
+         * @brief 해제된 페이지는 이후 Allocate가 다시 내줄 수 있음 (호출한 쪽이 더 이상 참조하지 않아야 함)
+         * @return 할당된 적 없는 페이지(high-water mark 밖)이거나 이미 free인 페이지면 false (아무것도 바꾸지 않음)
+         */
+        bool Free(PageId page_id);
+
+        // 지금 free list에 있는 페이지인지
+        bool IsFree(PageId page_id) const;
+
+        // free list + high-water mark를 fsm 파일에 저장 (정상 종료 시. 해제된 페이지가 없으면 쓰지 않음)
+        void Save();
+
+        size_t GetNumFreePages() const { return num_free_.load(std::memory_order_relaxed); }
+
+        inline const PageAllocatorMetrics& get_metrics() const { return metrics_; }
+
+    private:
+        // fsm 파일을 읽어서 free list, high-water mark 복원 후 파일 삭제
+        void Load();
+
+        bool PopFree(PageId* page_id);
+
+        struct alignas(CACHE_LINE_SIZE) Shard {
+            mutable std::mutex mutex_;
+            std::vector<PageId> pages_;
+
+            // 비트 i = 페이지 (i * METRICS_SHARDS + 샤드 번호)가 free. 필요한 만큼만 늘림
+            std::vector<uint64_t> free_bits_;
+
+            // 비트를 바꾸고 이전 값 반환 (mutex_를 잡은 상태에서 호출)
+            bool SetFree(PageId page_id, bool free);
+        };
+
+        static inline size_t ShardOf(PageId page_id) { return static_cast<size_t>(page_id % METRICS_SHARDS); }
+
+        Tablespace* tablespace_;
+        std::string fsm_path_;
+
+        std::array<Shard, METRICS_SHARDS> shards_;
+
+        // 전체 free 페이지 수. 0이면 샤드를 보지 않고 바로 high-water mark에서 할당
+        std::atomic<size_t> num_free_{0};
+
+        PageAllocatorMetrics metrics_;
+    };
+}
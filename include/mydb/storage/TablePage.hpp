@@ -4,9 +4,12 @@
 #include <optional>
 #include "mydb/storage/Page.hpp"
 #include "mydb/storage/Tuple.hpp"
+#include "mydb/recovery/Transaction.hpp"
 
 namespace mydb {
 
+    class LogManager;
+
     struct SlottedPageHeader {
         PageId next_page_id_ = INVALID_PAGE_ID; // Table scan 용도
         PageId prev_page_id_ = INVALID_PAGE_ID;
@@ -28,16 +31,13 @@ namespace mydb {
      */
     class TablePage : public Page { // 상속
     public:
-        // 페이지 생성 시 헤더 초기화
-        void Init(PageId page_id, PageId prev_id = INVALID_PAGE_ID, PageId next_id = INVALID_PAGE_ID) {
-            // 헤더 객체 가져오기 (메모리 재해석?)
-            auto* header = GetHeader();
-
-            header->next_page_id_ = next_id;
-            header->prev_page_id_ = prev_id;
-            header->num_slots_ = 0;
-            header->free_space_pointer_ = PAGE_SIZE; // 데이터 영역은 맨 끝부터
-        }
+        /**
+         * @brief 페이지 생성 시 헤더 초기화
+         * txn, log_manager를 둘 다 넘기면 INIT_PAGE 로그를 먼저 남기고 페이지 LSN을 갱신함 (이하 수정 함수들 동일)
+         * 하나라도 nullptr이면 로그 없이 페이지만 바꿈 (페이지 LSN도 그대로)
+         */
+        void Init(PageId page_id, PageId prev_id = INVALID_PAGE_ID, PageId next_id = INVALID_PAGE_ID,
+                  Transaction* txn = nullptr, LogManager* log_manager = nullptr);
 
         // 헤더 영역의 포인터 반환
         SlottedPageHeader* GetHeader() {
@@ -55,6 +55,11 @@ namespace mydb {
             return reinterpret_cast<Slot*>(ptr);
         }
 
+        // 읽기 전용 슬롯 배열 (pin만 하고 수정하지 않는 스캔용)
+        const Slot* GetSlotArray() const {
+            return reinterpret_cast<const Slot*>(get_data() + sizeof(SlottedPageHeader));
+        }
+
         // 남은 빈 데이터 영역 크기 계산
         // = 현재 마지막 데이터 영역 지점 - 슬롯 배열 끝 지점
         uint32_t GetFreeSpaceRemaining() {
@@ -69,22 +74,30 @@ namespace mydb {
          * @brief 튜플 삽입 (row의 데이터 메모리에 추가) -> 핵심 로직
          * @return 성공여부
          */
-        bool InsertTuple(const Tuple& tuple, uint16_t* slot_id);
+        bool InsertTuple(const Tuple& tuple, uint16_t* slot_id,
+                         Transaction* txn = nullptr, LogManager* log_manager = nullptr);
 
         /**
          * @brief 튜플 조회
          * @param slot_id 조회할 슬롯 번호
-         * @param tuple (출력용) 조회된 데이터를 담을 객체 포인터 (out매개변수)
+         * @param tuple (출력용) 조회된 데이터를 담을 객체 포인터 (out매개변수). 기존 버퍼에 들어가면 재사용
+         * @param arena 넘기면 tuple의 버퍼가 모자랄 때 힙 대신 여기서 할당 (쿼리 단위로 Reset)
          * @return 성공여부 (삭제됐거나 인덱스 범위 초과 시 false)
          */
-        bool GetTuple(uint16_t slot_id, Tuple* tuple);
+        bool GetTuple(uint16_t slot_id, Tuple* tuple, TupleArena* arena = nullptr);
 
         /**
          * @brief 슬롯 삭제 (tombstone 마킹)
          * @param slot_id 삭제할 슬롯 번호
          * @return 성공 여부
          */
-        bool MarkDelete(uint16_t slot_id);
+        bool MarkDelete(uint16_t slot_id, Transaction* txn = nullptr, LogManager* log_manager = nullptr);
+
+        /**
+         * @brief 삭제 표시된 슬롯을 되살림 (MarkDelete의 undo, 복구 시에만 사용)
+         * soft delete라 데이터는 그대로 남아 있으므로 슬롯 정보만 복원하면 됨
+         */
+        void RestoreSlot(uint16_t slot_id, uint16_t offset, uint16_t length);
 
     private:
         // 자체 멤버변수 없음. Page의 data_만 해석해서 사용.
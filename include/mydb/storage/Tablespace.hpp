@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mydb/common/Metrics.hpp"
+#include "mydb/storage/Page.hpp"
+
+namespace mydb {
+
+    struct TablespaceOptions {
+        /*
+         * DB 파일 외에 같이 쓸 데이터 파일 경로 (다른 디렉토리/디바이스 가능). 비어 있으면 DB 파일 하나만 사용 (기존 배치 그대로)
+         * 있으면 DB 파일이 0번, 여기 있는 파일이 1..n번이 되고, 세그먼트 단위로 파일들에 번갈아 배치됨
+         * 파일 목록과 세그먼트 크기는 처음 만들 때 <DB 파일>.tbs에 기록되고, 다시 열 때 일치해야 함
+         */
+        std::vector<std::string> extra_files;
+
+        // 세그먼트 크기 (페이지 수). 4096 = 64MB
+        PageId segment_pages = 4096;
+
+        // 파일을 늘릴 때 한 번에 늘리는 페이지 수 (64 = 1MB). 할당 대부분은 파일 I/O 없이 atomic 증가 한 번으로 끝남
+        PageId extend_pages = 64;
+
+        /*
+         * true면 데이터 파일을 O_RDONLY로 엶 (읽기 전용 mmap 버퍼 풀, 다른 프로세스가 쓰는 DB의 스냅샷 읽기용)
+         * 없는 파일은 만들지 않고, .tbs도 쓰지 않음. 할당/쓰기는 실패하고, 종료할 때 파일을 자르거나 .fsm을 건드리지 않음
+         */
+        bool read_only = false;
+    };
+
+    // 데이터 파일 하나의 I/O 지표
+    struct DataFileMetrics {
+        ShardedCounter pages_read;
+        ShardedCounter pages_written;
+    };
+
+    /**
+     * @brief 페이지 ID(64비트 논리 주소) -> (데이터 파일, 파일 내 offset) 매핑 + 파일별 I/O
+     *
+     * 페이지 p는 세그먼트 s = p / segment_pages에 속하고, 세그먼트 s는 파일 s % n의 (s / n)번째 세그먼트 자리에 있음.
+     * 파일마다 fd를 따로 열고 pread/pwrite로만 접근하므로 공유 락이 없고,
+     * 서로 다른 파일(디바이스)로 가는 읽기/쓰기는 각 디바이스의 큐에서 동시에 처리된다.
+     * 파일이 하나면 page_id * PAGE_SIZE 그대로라 기존 DB 파일과 호환
+     */
+    class Tablespace {
+    public:
+        Tablespace(const std::string& db_file, const TablespaceOptions& options = {});
+
+        ~Tablespace();
+
+        Tablespace(const Tablespace&) = delete;
+        Tablespace& operator=(const Tablespace&) = delete;
+
+        // 페이지 위치
+        struct Location {
+            size_t file_index;
+            uint64_t offset;
+        };
+
+        inline Location Locate(PageId page_id) const {
+            PageId segment = page_id / segment_pages_;
+            PageId in_segment = page_id % segment_pages_;
+            uint64_t local_segment = segment / files_.size();
+            return Location{static_cast<size_t>(segment % files_.size()),
+                            (local_segment * segment_pages_ + in_segment) * PAGE_SIZE};
+        }
+
+        // 할당되지 않은 페이지면 std::runtime_error
+        void ReadPage(PageId page_id, char* data);
+
+        /**
+         * @brief 페이지 쓰기. 체크섬은 따로 받아서 마지막 4바이트 자리에 씀
+         * (호출한 쪽의 const 페이지를 고치지 않고 pwritev 한 번으로)
+         */
+        void WritePage(PageId page_id, const char* data, uint32_t checksum);
+
+        /**
+         * @brief [first, first + count) 읽기. 세그먼트 경계마다 나눠서 파일별 순차 읽기 한 번씩
+         * @return 실제로 읽은 페이지 수 (할당된 범위를 넘는 부분은 잘림)
+         */
+        PageId ReadPages(PageId first, PageId count, char* data);
+
+        /**
+         * @brief 다음 페이지 ID 할당 (high-water mark를 atomic으로 증가)
+         * 파일이 이미 그 페이지까지 늘어나 있으면 락도 I/O도 없음. 아니면 한 스레드가 extend_pages만큼 미리 늘림 (ftruncate, 0으로 채워짐)
+         * 파일 크기는 항상 할당된 페이지 수 이상이므로, 크래시 후 파일 크기에서 계산한 값으로 다시 시작해도 같은 ID를 두 번 내주지 않음
+         */
+        PageId AllocatePage();
+
+        // 할당된 페이지 수 (high-water mark)
+        inline PageId GetNumPages() const { return num_pages_.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 정상 종료 때 저장해둔 high-water mark로 되돌림 (미리 늘려두고 안 쓴 페이지를 버리지 않게)
+         * 파일 크기에서 계산한 값보다 클 수 없음. 아무 페이지도 할당하기 전에만 호출
+         */
+        void RestoreNumPages(PageId num_pages);
+
+        /**
+         * @brief high-water mark를 최소 num_pages로 올리고 파일도 그만큼 늘림 (이미 크면 아무것도 안 함)
+         * free list와 무관하게 특정 페이지 자리를 만들 때 (복구 중 로그에 나온 페이지). 다른 할당과 동시에 호출하지 않음
+         */
+        void GrowNumPages(PageId num_pages);
+
+        // 미리 늘려두고 할당하지 않은 뒷부분을 잘라냄 (정상 종료 시. 다음에 열 때 파일 크기 = high-water mark)
+        void TrimToNumPages();
+
+        // 모든 파일의 변경을 디스크에 영속화 (fdatasync)
+        void Sync();
+
+        void Close();
+
+        inline bool is_read_only() const { return read_only_; }
+        inline size_t get_num_files() const { return files_.size(); }
+        inline const std::string& get_file_name(size_t index) const { return files_[index].path_; }
+        inline PageId get_segment_pages() const { return segment_pages_; }
+        inline PageId get_extent_pages() const { return extent_pages_.load(std::memory_order_acquire); }
+        inline const DataFileMetrics& get_file_metrics(size_t index) const { return *files_[index].metrics_; }
+
+    private:
+        struct DataFile {
+            std::string path_;
+            int fd_ = -1;
+            PageId size_pages_ = 0; // 파일에 있는 페이지 자리 수 (extend_mutex_로 보호)
+            std::unique_ptr<DataFileMetrics> metrics_;
+        };
+
+        // 파일 크기로부터 할당된 페이지 수 계산 (할당은 항상 순서대로이므로 가장 뒤에 있는 페이지 + 1)
+        PageId ComputeNumPages();
+
+        // [0, num_pages) 중 file_index번 파일에 들어가는 페이지 수
+        PageId LocalPages(PageId num_pages, size_t file_index) const;
+
+        // 파일들을 늘려서 [0, num_pages) 페이지 자리를 모두 덮음 (extend_mutex_를 잡은 상태에서 호출)
+        void ExtendTo(PageId num_pages);
+
+        // <db_file>.tbs를 만들거나, 있으면 파일 목록/세그먼트 크기가 같은지 확인
+        void CheckDescriptor(const std::string& descriptor_path);
+
+        std::vector<DataFile> files_;
+        PageId segment_pages_;
+        PageId extend_pages_;
+        bool read_only_;
+
+        std::atomic<PageId> num_pages_{0};    // 할당된 페이지 수 (high-water mark)
+        std::atomic<PageId> extent_pages_{0}; // 파일들이 덮고 있는 페이지 수 (>= num_pages_가 되도록 유지)
+        std::mutex extend_mutex_; // 파일 늘리기만 직렬화. 읽기/쓰기는 락 없음
+    };
+}
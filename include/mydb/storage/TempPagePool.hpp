@@ -0,0 +1,71 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mydb/storage/PageAllocator.hpp"
+
+namespace mydb {
+
+    /**
+     * @brief 임시 페이지(정렬 run, 해시 spill) 전용 ID 풀
+     *
+     * PageAllocator에서 TEMP_RESERVE_PAGES개씩 받아서, 받은 ID를 <DB 파일>.spill에 먼저 기록(fdatasync)한 뒤 내줌.
+     * 반납된 임시 페이지는 일반 free list로 보내지 않고 이 풀 안에서만 재사용하므로, .spill에 적힌 ID는 실행 중 항상 임시 페이지임.
+     *
+     * 정상 종료(Release): 풀의 페이지를 모두 PageAllocator에 돌려주고 .spill 삭제
+     * 크래시 후 다음 시작: .spill이 남아 있으면 적힌 페이지를 모두 PageAllocator에 돌려줌
+     * (임시 페이지는 로그를 남기지 않으므로 복구할 내용이 없음 -> 크래시로 spill 페이지가 새지 않음)
+     */
+    class TempPagePool {
+    public:
+        // 한 번에 PageAllocator에서 받아서 기록하는 페이지 수 (fdatasync 한 번으로 64페이지)
+        static constexpr size_t TEMP_RESERVE_PAGES = 64;
+
+        /**
+         * @param read_only true면 .spill을 읽거나 지우지 않음 (Allocate는 쓰지 않는다는 전제)
+         */
+        TempPagePool(PageAllocator* allocator, std::string spill_path, bool read_only);
+
+        ~TempPagePool();
+
+        TempPagePool(const TempPagePool&) = delete;
+        TempPagePool& operator=(const TempPagePool&) = delete;
+
+        // 임시 페이지 ID 하나. 풀이 비었으면 PageAllocator에서 더 받아서 .spill에 기록한 뒤 내줌
+        PageId Allocate();
+
+        // 풀로 반납 (이후 Allocate가 다시 내줌). 이 풀의 페이지가 아니거나 이미 반납됐으면 false
+        bool Free(PageId page_id);
+
+        // 이 풀이 가진 페이지인지 (사용 중이든 반납됐든). 일반 DeallocatePage가 임시 페이지를 free list에 넣지 않게
+        bool IsTempPage(PageId page_id) const;
+
+        // 정상 종료: 풀의 페이지를 모두 PageAllocator에 돌려주고 .spill 삭제 (PageAllocator::Save 전에 호출)
+        void Release();
+
+        size_t GetNumPages() const;
+        size_t GetNumFreePages() const;
+
+        // 크래시 후 시작할 때 .spill에서 돌려준 페이지 수
+        inline size_t get_num_reclaimed() const { return num_reclaimed_; }
+
+    private:
+        // 이전 실행이 남긴 .spill의 페이지를 PageAllocator에 돌려주고 파일 삭제
+        void Reclaim();
+
+        // PageAllocator에서 TEMP_RESERVE_PAGES개를 받아 .spill에 기록하고 free_에 넣음 (mutex_를 잡은 상태에서 호출)
+        void Reserve();
+
+        PageAllocator* allocator_;
+        std::string spill_path_;
+        int fd_ = -1; // 처음 Reserve할 때 엶
+
+        mutable std::mutex mutex_;
+        std::unordered_map<PageId, bool> pages_; // 풀의 페이지 -> 사용 중 여부
+        std::vector<PageId> free_;
+        size_t num_reclaimed_ = 0;
+    };
+}
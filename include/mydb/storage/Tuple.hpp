@@ -4,32 +4,123 @@
 #include <cstring>
 #include <cstdint>
 
+#include "mydb/storage/TupleArena.hpp"
+
 namespace mydb {
     /**
      * @brief 행(Row) 데이터가 실제로 db에 저장될 때, 그 데이터를 담는 컨테이너
+     *
+     * 데이터 위치는 세 가지 (행마다 malloc하지 않도록)
+     * - inline: INLINE_SIZE 이하면 객체 안의 버퍼에 (짧은 행은 할당 없음)
+     * - arena: 생성/Assign 때 TupleArena를 넘기면 거기서 잘라 씀 (해제는 arena Reset으로 한 번에)
+     * - 힙: 그 외. 이미 가진 버퍼에 들어가면 Assign이 재사용함
+     * 복사하면 항상 inline/힙에 자기 데이터를 가짐 (arena 튜플을 arena보다 오래 들고 있으려면 복사)
      */
     class Tuple {
     public:
+        // sizeof(Tuple) == 64 (캐시 라인 하나)
+        static constexpr uint32_t INLINE_SIZE = 48;
+
         Tuple() = default;
 
         // 데이터를 복사해서 생성
         // Tuple클래스는 data_라는 멤버변수를 가지고,
         // 생성자는 vector<char>& 타입의 매개변수를 받아 data_에 할당함
-        Tuple(const std::vector<char>& data) : data_(data) {}
+        Tuple(const std::vector<char>& data) { Assign(data.data(), static_cast<uint32_t>(data.size())); }
+
+        // 포인터로부터 생성(복사). arena를 넘기면 INLINE_SIZE보다 큰 데이터는 arena에 둠
+        Tuple(const char* data, uint32_t size, TupleArena* arena = nullptr) { Assign(data, size, arena); }
+
+        Tuple(const Tuple& other) { Assign(other.data_, other.size_); }
+
+        Tuple(Tuple&& other) noexcept { MoveFrom(other); }
+
+        Tuple& operator=(const Tuple& other) {
+            if (this != &other) {
+                Assign(other.data_, other.size_);
+            }
+            return *this;
+        }
+
+        Tuple& operator=(Tuple&& other) noexcept {
+            if (this != &other) {
+                Release();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        ~Tuple() { Release(); }
 
-        // 포인터로부터 생성(복사)
-        Tuple(const char* data, uint32_t size) {
-            data_.resize(size);
-            std::memcpy(data_.data(), data, size); // dest, src(start), size
+        /**
+         * @brief 내용을 data로 바꿈
+         * 지금 버퍼(inline 또는 힙)에 들어가면 그대로 덮어씀 -> 같은 Tuple로 스캔하면 행마다 할당이 없음.
+         * 모자라면 arena(nullptr면 힙)에서 새로 받음
+         */
+        inline void Assign(const char* data, uint32_t size, TupleArena* arena = nullptr) {
+            if (size > GetCapacity()) {
+                Reserve(size, arena);
+            }
+            std::memmove(data_, data, size);
+            size_ = size;
         }
 
-        inline uint32_t GetSize() const { return static_cast<uint32_t>(data_.size()); }
-        inline const char* GetData() const { return data_.data(); }
+        inline uint32_t GetSize() const { return size_; }
+        inline const char* GetData() const { return data_; }
+
+        inline bool is_inline() const { return data_ == inline_; }
 
     private:
-        // 실제 데이터 바이트
-        std::vector<char> data_;
+        // 힙 버퍼를 가지고 있는지 (arena 버퍼는 capacity_ == 0)
+        inline bool OwnsHeap() const { return data_ != inline_ && capacity_ != 0; }
+
+        // 덮어쓸 수 있는 크기 (arena 버퍼는 다른 튜플과 붙어 있을 수 있으므로 0)
+        inline uint32_t GetCapacity() const { return is_inline() ? INLINE_SIZE : capacity_; }
+
+        // size 바이트를 담을 버퍼로 교체 (기존 내용은 버림)
+        void Reserve(uint32_t size, TupleArena* arena) {
+            Release();
+            if (size <= INLINE_SIZE) {
+                return;
+            }
+            if (arena != nullptr) {
+                data_ = arena->Allocate(size);
+            } else {
+                data_ = new char[size];
+                capacity_ = size;
+            }
+        }
+
+        void Release() {
+            if (OwnsHeap()) {
+                delete[] data_;
+            }
+            data_ = inline_;
+            capacity_ = 0;
+        }
+
+        // other는 빈 inline 튜플이 됨 (this는 Release된 상태에서 호출)
+        void MoveFrom(Tuple& other) {
+            size_ = other.size_;
+            if (other.is_inline()) {
+                std::memcpy(inline_, other.inline_, other.size_);
+            } else {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+                other.data_ = other.inline_;
+                other.capacity_ = 0;
+            }
+            other.size_ = 0;
+        }
+
+        // 실제 데이터 바이트 (inline_, arena, 힙 중 하나를 가리킴)
+        char* data_ = inline_;
+        uint32_t size_ = 0;
+        uint32_t capacity_ = 0; // 힙 버퍼 크기 (inline, arena면 0)
+        char inline_[INLINE_SIZE];
 
         // 추후 다른 정보 추가
     };
-}
\ No newline at end of file
+
+    static_assert(sizeof(Tuple) == 64);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace mydb {
+
+    /**
+     * @brief 튜플 데이터용 bump allocator (쿼리 하나 = 스레드 하나가 소유. 락 없음)
+     * 블록(기본 64KB)에서 포인터를 밀면서 잘라주기만 하고 개별 해제는 없음. Reset으로 한 번에 비움.
+     * Reset해도 블록은 남겨두므로, 같은 arena를 다음 쿼리에 다시 쓰면 malloc이 전혀 없음.
+     * 여기서 받은 메모리(arena 튜플)는 Reset/소멸 이후에 쓰면 안 됨
+     */
+    class TupleArena {
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit TupleArena(size_t block_size = DEFAULT_BLOCK_SIZE);
+
+        TupleArena(const TupleArena&) = delete;
+        TupleArena& operator=(const TupleArena&) = delete;
+
+        // 8바이트 정렬된 size 바이트
+        inline char* Allocate(size_t size) {
+            size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+            if (size <= static_cast<size_t>(end_ - cursor_)) {
+                char* ptr = cursor_;
+                cursor_ += size;
+                bytes_used_ += size;
+                return ptr;
+            }
+            return AllocateSlow(size);
+        }
+
+        // 지금까지 내준 메모리를 모두 버림 (일반 블록은 재사용하려고 남기고, 큰 요청용 블록만 해제)
+        void Reset();
+
+        inline size_t get_bytes_used() const { return bytes_used_; }
+        inline size_t get_num_blocks() const { return blocks_.size(); }
+
+    private:
+        static constexpr size_t ALIGNMENT = 8;
+
+        // 현재 블록이 모자랄 때: 다음 블록으로 넘어가거나 (없으면 새로 할당), 큰 요청이면 전용 블록
+        char* AllocateSlow(size_t size);
+
+        size_t block_size_;
+
+        std::vector<std::unique_ptr<char[]>> blocks_;
+        size_t next_block_ = 0; // 다음에 쓸 blocks_ 인덱스 (Reset하면 0부터 다시)
+
+        // block_size_ / 4보다 큰 요청은 블록을 따로 잡음 (일반 블록의 남은 공간을 버리지 않게)
+        std::vector<std::unique_ptr<char[]>> large_blocks_;
+
+        char* cursor_ = nullptr;
+        char* end_ = nullptr;
+        size_t bytes_used_ = 0;
+    };
+}
@@ -0,0 +1,120 @@
+#include "mydb/buffer/AccessTrace.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace mydb {
+
+    namespace {
+        constexpr size_t TRACE_BUFFER_SIZE = 64 * 1024;
+        constexpr size_t TRACE_HEADER_SIZE = 16;
+        constexpr int TRACE_TYPE_BITS = 3;
+        constexpr uint64_t TRACE_TYPE_MASK = (1u << TRACE_TYPE_BITS) - 1;
+
+        inline uint64_t ZigZag(int64_t value) {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        inline int64_t UnZigZag(uint64_t value) {
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+    }
+
+    TraceWriter::TraceWriter(const std::string& path) : out_(path, std::ios::binary | std::ios::trunc) {
+        if (!out_.is_open()) {
+            throw std::runtime_error("Failed to open trace file: " + path + " | Error: " + std::strerror(errno));
+        }
+
+        char header[TRACE_HEADER_SIZE] = {};
+        std::memcpy(header, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+        std::memcpy(header + sizeof(TRACE_MAGIC), &TRACE_VERSION, sizeof(TRACE_VERSION));
+        out_.write(header, sizeof(header));
+
+        buffer_.reserve(TRACE_BUFFER_SIZE + 16);
+    }
+
+    TraceWriter::~TraceWriter() {
+        Flush();
+    }
+
+    void TraceWriter::Record(TraceEventType type, PageId page_id) {
+        int64_t delta = static_cast<int64_t>(page_id) - static_cast<int64_t>(last_page_id_);
+        last_page_id_ = page_id;
+
+        // LEB128: 7비트씩, 이어지는 바이트가 있으면 최상위 비트 1
+        uint64_t value = (ZigZag(delta) << TRACE_TYPE_BITS) | static_cast<uint64_t>(type);
+        while (value >= 0x80) {
+            buffer_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        buffer_.push_back(static_cast<char>(value));
+        num_events_++;
+
+        if (buffer_.size() >= TRACE_BUFFER_SIZE) {
+            Flush();
+        }
+    }
+
+    void TraceWriter::Flush() {
+        if (!buffer_.empty()) {
+            out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+        out_.flush();
+    }
+
+    TraceReader::TraceReader(const std::string& path) : in_(path, std::ios::binary), buffer_(TRACE_BUFFER_SIZE) {
+        if (!in_.is_open()) {
+            throw std::runtime_error("Failed to open trace file: " + path + " | Error: " + std::strerror(errno));
+        }
+
+        char header[TRACE_HEADER_SIZE];
+        uint32_t version = 0;
+        if (!in_.read(header, sizeof(header)) || std::memcmp(header, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+            throw std::runtime_error("Not a trace file: " + path);
+        }
+        std::memcpy(&version, header + sizeof(TRACE_MAGIC), sizeof(version));
+        if (version != TRACE_VERSION) {
+            throw std::runtime_error("Unsupported trace version " + std::to_string(version) + ": " + path);
+        }
+    }
+
+    bool TraceReader::ReadByte(uint8_t* byte) {
+        if (pos_ == size_) {
+            in_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            size_ = static_cast<size_t>(in_.gcount());
+            pos_ = 0;
+            if (size_ == 0) {
+                return false;
+            }
+        }
+        *byte = static_cast<uint8_t>(buffer_[pos_++]);
+        return true;
+    }
+
+    bool TraceReader::Next(TraceEvent* event) {
+        uint64_t value = 0;
+        int shift = 0;
+        uint8_t byte;
+        do {
+            if (!ReadByte(&byte) || shift > 63) {
+                return false;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        // 정의되지 않은 type은 깨진 트레이스로 보고 거기서 멈춤
+        if ((value & TRACE_TYPE_MASK) > static_cast<uint64_t>(TraceEventType::DELETE)) {
+            return false;
+        }
+
+        int64_t delta = UnZigZag(value >> TRACE_TYPE_BITS);
+        last_page_id_ = static_cast<PageId>(static_cast<int64_t>(last_page_id_) + delta);
+
+        event->type_ = static_cast<TraceEventType>(value & TRACE_TYPE_MASK);
+        event->page_id_ = last_page_id_;
+        return true;
+    }
+}
@@ -1,18 +1,52 @@
 #include "mydb/buffer/BufferPoolManager.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <new>
 
 namespace mydb {
 
-    BufferPoolManager::BufferPoolManager(size_t pool_size, DiskManager* disk_manager)
-        : pool_size_(pool_size), disk_manager_(disk_manager) {
+    BufferPoolManager::BufferPoolManager(size_t pool_size, DiskManager* disk_manager, LogManager* log_manager,
+                                         const BufferPoolOptions& options)
+        : pool_size_(pool_size), pages_(nullptr), disk_manager_(disk_manager), log_manager_(log_manager),
+          read_only_(options.mmap_read_only) {
 
-        /* 컴파일타임에 크기가 결정되지 않는 배열을 만들려면, 동적할당해야 함
-         * (스택에 할당할 메모리 크기를 결정할 수 없으므로, 힙에 할당하고 스택에는 포인터만 둬야 함.
-         * ((참고) 스택 프레임 오프셋 결정)
+        if (read_only_) {
+            if (log_manager_ != nullptr) {
+                throw std::runtime_error("Read-only mmap buffer pool cannot be used with a LogManager");
+            }
+            if (!disk_manager_->is_read_only()) {
+                throw std::runtime_error("Read-only mmap buffer pool requires a DiskManager opened read-only: " +
+                                         disk_manager_->get_file_name());
+            }
+
+            // 프레임은 만들지 않음 (페이지 캐시가 버퍼 풀 역할)
+            pool_size_ = 0;
+            replacer_ = MakeReplacer(options.replacer, 0);
+
+            PageId num_pages = disk_manager_->MapFile(options.mmap_access_pattern);
+            size_t num_words = (static_cast<size_t>(num_pages) + 63) / 64;
+            verified_ = std::make_unique<std::atomic<uint64_t>[]>(num_words);
+            for (size_t i = 0; i < num_words; i++) {
+                verified_[i].store(0, std::memory_order_relaxed);
+            }
+            return;
+        }
+
+        frames_.resize(pool_size_);
+        page_epochs_.resize(PAGE_EPOCH_SLOTS, 0);
+
+        /* 프레임 배열은 mmap한 영역 위에 둠 (new Page[]는 생성자가 전체를 0으로 채우면서 모든 메모리를 한 스레드에서 건드림)
+         * 여기서는 페이지 객체만 만들고 데이터는 건드리지 않으므로, 각 프레임은 처음 쓰일 때 fault됨
          */
-        pages_ = new Page[pool_size_];
+        arena_ = std::make_unique<FrameArena>(pool_size_ * PAGE_SIZE, options.arena);
+        pages_ = reinterpret_cast<Page*>(arena_->get_data());
+        for (size_t i = 0; i < pool_size_; i++) {
+            new (&pages_[i]) Page(Page::UninitializedTag{});
+        }
 
-        replacer_ = new LRUReplacer(pool_size);
+        replacer_ = MakeReplacer(options.replacer, pool_size);
 
         // 처음 생성하면 모든 프레임이 비어있음.
         for (size_t i = 0; i < pool_size_; i++) {
@@ -21,20 +55,40 @@ namespace mydb {
     }
 
     BufferPoolManager::~BufferPoolManager() {
-        delete[] pages_;
-        delete replacer_;
+        if (read_only_) {
+            disk_manager_->UnmapFile();
+        }
+        // Page는 소멸자에서 하는 일이 없으므로, 영역만 해제 (arena_ 소멸자)
+        StopTrace();
     }
 
     // 페이지 요청
     Page* BufferPoolManager::FetchPage(PageId page_id) {
-        std::scoped_lock lock(mutex_);
+        if (read_only_) {
+            return FetchMappedPage(page_id);
+        }
+
+        auto lock = LockPool();
+        if (trace_ != nullptr) {
+            trace_->Record(TraceEventType::FETCH, page_id);
+        }
 
         // 이미 메모리에 있는 경우(Cache hit)
         if (page_table_.find(page_id) != page_table_.end()) {
             FrameId frame_id = page_table_[page_id];
+            metrics_.fetch_hits.Add();
 
             // pin count 증가 (unpin -> pin으로 바뀌는 경우 포함)
-            pages_[frame_id].pin_count_++;
+            FrameMeta& meta = frames_[frame_id];
+            meta.pin_count_++;
+            meta.last_access_ = ++access_clock_;
+            TrackRecLsn(meta);
+
+            // 워밍업이 미리 올려둔 페이지의 첫 요청 = 워밍업이 없었으면 miss였을 요청
+            if (meta.prewarmed_) {
+                meta.prewarmed_ = false;
+                metrics_.prewarm_hits.Add();
+            }
 
             // 사용중이므로 LRU List (삭제가능대상 리스트)에서 제거
             replacer_->Pin(frame_id);
@@ -43,6 +97,7 @@ namespace mydb {
         }
 
         // 메모리에 없는 경우 -> 빈자리 찾고, 디스크에서 읽어온다
+        metrics_.fetch_misses.Add();
         FrameId frame_id;
         if (!FindFreeFrameFromVictim(&frame_id)) {
             return nullptr; // 버퍼 풀에 빈자리가 없음(pin상태인 프레임으로 꽉 참)
@@ -50,18 +105,32 @@ namespace mydb {
 
         // 찾았다면, frame_id = 빈 프레임 id
         Page& page = pages_[frame_id];
+        FrameMeta& meta = frames_[frame_id];
 
         // 매핑 테이블에 기존 정보가 남아있으면, 삭제
-        if (page.page_id_ != INVALID_PAGE_ID) {
-            page_table_.erase(page.page_id_);
+        if (meta.page_id_ != INVALID_PAGE_ID) {
+            page_table_.erase(meta.page_id_);
         }
 
         // 디스크에서 읽어오기
-        page.page_id_ = page_id;
-        page.pin_count_ = 1;
-        page.is_dirty_ = false;
-
-        disk_manager_->ReadPage(page_id, page);
+        meta.page_id_ = page_id;
+        meta.pin_count_ = 1;
+        meta.is_dirty_ = false;
+        meta.rec_lsn_ = INVALID_LSN;
+        meta.last_access_ = ++access_clock_;
+        meta.prewarmed_ = false;
+        TrackRecLsn(meta);
+
+        try {
+            disk_manager_->ReadPage(page_id, page);
+            // 아직 한 번도 쓰이지 않은(0으로 채워진) 페이지도 자기 ID를 알 수 있게
+            page.set_page_id(page_id);
+        } catch (...) {
+            // 손상된 페이지(PageCorruptionError, 로그는 VerifyChecksum이 남김)나 읽기 실패면 버퍼 풀에 올리지 않음
+            // 프레임은 다시 빈 프레임으로 돌려놓고 호출한 쪽에 알림
+            ReleaseFrame(frame_id);
+            throw;
+        }
 
         // 메타데이터 업데이트
         replacer_->Pin(frame_id);
@@ -71,7 +140,12 @@ namespace mydb {
     }
 
     bool BufferPoolManager::UnpinPage(PageId page_id, bool is_dirty) {
-        std::scoped_lock lock(mutex_);
+        if (read_only_) {
+            // pin 상태를 관리하지 않음 (매핑은 풀이 살아있는 동안 유지됨)
+            return !is_dirty && page_id < disk_manager_->get_num_mapped_pages();
+        }
+
+        auto lock = LockPool();
 
         // 메모리에 없으면 실패
         if (page_table_.find(page_id) == page_table_.end()) {
@@ -79,29 +153,45 @@ namespace mydb {
         }
 
         FrameId frame_id = page_table_[page_id];
-        Page& page = pages_[frame_id];
+        FrameMeta& meta = frames_[frame_id];
 
         // 사용중인 곳이 없는데 unpin 시도 -> 로직 오류
-        if (page.pin_count_ <= 0) {
+        if (meta.pin_count_ <= 0) {
             return false;
         }
 
+        if (trace_ != nullptr) {
+            trace_->Record(is_dirty ? TraceEventType::UNPIN_DIRTY : TraceEventType::UNPIN, page_id);
+        }
+
         // 수정여부 반영
-        page.is_dirty_ |= is_dirty;
+        meta.is_dirty_ |= is_dirty;
+        if (is_dirty) {
+            meta.dirty_gen_++;
+        }
 
         // 핀 카운트 감소
-        page.pin_count_--;
+        meta.pin_count_--;
 
         // 사용중인 곳이 없으면, 삭제 가능 리스트에 등록
-        if (page.pin_count_ == 0) {
+        if (meta.pin_count_ == 0) {
             replacer_->Unpin(frame_id);
+
+            // 아무도 안 쓰고 수정된 것도 없으면, 다음 수정을 위해 rec_lsn 초기화
+            if (!meta.is_dirty_) {
+                meta.rec_lsn_ = INVALID_LSN;
+            }
         }
 
         return true;
     }
 
     bool BufferPoolManager::FlushPage(PageId page_id) {
-        std::scoped_lock lock(mutex_);
+        if (read_only_) {
+            return false;
+        }
+
+        auto lock = LockPool();
 
         if (page_table_.find(page_id) == page_table_.end()) {
             return false;
@@ -109,39 +199,180 @@ namespace mydb {
 
         FrameId frame_id = page_table_[page_id];
         Page& page = pages_[frame_id];
+        FrameMeta& meta = frames_[frame_id];
+
+        // WAL: 페이지에 반영된 로그가 먼저 디스크에 있어야 함
+        if (log_manager_ != nullptr) {
+            log_manager_->Flush(page.get_lsn());
+        }
 
         // 디스크 쓰기
         disk_manager_->WritePage(page_id, page);
-        page.is_dirty_ = false;
+        meta.is_dirty_ = false;
+
+        // 누가 pin하고 있으면 로그만 남기고 아직 반영 안 한 변경이 있을 수 있으므로 rec_lsn 유지
+        if (meta.pin_count_ == 0) {
+            meta.rec_lsn_ = INVALID_LSN;
+        }
 
         return true;
     }
 
+    void BufferPoolManager::FlushAllPages() {
+        auto lock = LockPool();
+
+        for (size_t i = 0; i < pool_size_; i++) {
+            FrameMeta& meta = frames_[i];
+            if (meta.page_id_ == INVALID_PAGE_ID || !meta.is_dirty_) {
+                continue;
+            }
+
+            if (log_manager_ != nullptr) {
+                log_manager_->Flush(pages_[i].get_lsn());
+            }
+            disk_manager_->WritePage(meta.page_id_, pages_[i]);
+            meta.is_dirty_ = false;
+            if (meta.pin_count_ == 0) {
+                meta.rec_lsn_ = INVALID_LSN;
+            }
+        }
+    }
+
+    bool BufferPoolManager::WriteBackPage(PageId page_id, Page* scratch) {
+        if (read_only_) {
+            return false;
+        }
+
+        FrameId frame_id;
+        uint32_t dirty_gen;
+
+        // 1. 락을 잡은 동안에는 복사만 함. 쓰는 동안 쫓겨나지 않게 pin
+        {
+            auto lock = LockPool();
+
+            auto iter = page_table_.find(page_id);
+            if (iter == page_table_.end()) {
+                return false;
+            }
+
+            frame_id = iter->second;
+            FrameMeta& meta = frames_[frame_id];
+            if (!meta.is_dirty_) {
+                return false;
+            }
+
+            meta.pin_count_++;
+            replacer_->Pin(frame_id);
+
+            std::memcpy(scratch->get_data(), pages_[frame_id].get_data(), PAGE_SIZE);
+            dirty_gen = meta.dirty_gen_;
+        }
+
+        // 2. 로그 flush, 디스크 쓰기는 락 밖에서 (그동안 다른 스레드의 FetchPage는 막히지 않음)
+        if (log_manager_ != nullptr) {
+            log_manager_->Flush(scratch->get_lsn());
+        }
+        disk_manager_->WritePage(page_id, *scratch);
+
+        // 3. 복사 이후 새로 수정된 게 없을 때만 clean 처리
+        // (그 사이 다른 스레드가 FlushPage로 clean 처리했더라도, 새 수정이 있었으면 다시 dirty로 둬서
+        //  방금 쓴 옛 버전이 디스크에 남지 않게 함)
+        auto lock = LockPool();
+        FrameMeta& meta = frames_[frame_id];
+
+        if (meta.dirty_gen_ == dirty_gen) {
+            meta.is_dirty_ = false;
+            if (meta.pin_count_ == 1) {
+                meta.rec_lsn_ = INVALID_LSN;
+            }
+        } else {
+            meta.is_dirty_ = true;
+        }
+
+        meta.pin_count_--;
+        if (meta.pin_count_ == 0) {
+            replacer_->Unpin(frame_id);
+        }
+
+        return true;
+    }
+
+    std::vector<std::pair<PageId, Lsn>> BufferPoolManager::GetDirtyPageTable() {
+        auto lock = LockPool();
+
+        std::vector<std::pair<PageId, Lsn>> dirty_pages;
+        for (size_t i = 0; i < pool_size_; i++) {
+            const FrameMeta& meta = frames_[i];
+            if (meta.page_id_ == INVALID_PAGE_ID) {
+                continue;
+            }
+
+            // 수정 중일 수 있는(pin 상태 + rec_lsn 있음) 페이지도 포함
+            if (meta.is_dirty_ || (meta.pin_count_ > 0 && meta.rec_lsn_ != INVALID_LSN)) {
+                dirty_pages.emplace_back(meta.page_id_, meta.rec_lsn_);
+            }
+        }
+        return dirty_pages;
+    }
+
     Page* BufferPoolManager::NewPage(PageId* page_id) {
-        std::scoped_lock lock(mutex_);
+        return NewPageImpl(page_id, false);
+    }
+
+    Page* BufferPoolManager::NewTempPage(PageId* page_id) {
+        return NewPageImpl(page_id, true);
+    }
+
+    Page* BufferPoolManager::NewPageImpl(PageId* page_id, bool temp) {
+        if (read_only_) {
+            return nullptr;
+        }
+
+        // 새 페이지 할당 = 디스크 관련 작업이므로, 디스크 매니저에게
+        // 할당기는 여러 스레드가 동시에 써도 되므로 mutex_ 밖에서 (파일을 늘리는 동안 다른 요청을 막지 않게)
+        PageId new_page_id = temp ? disk_manager_->AllocateTempPage() : disk_manager_->AllocatePage();
+
+        auto lock = LockPool();
+
+        // 재사용된 ID의 옛 내용이 아직 프레임에 남아 있으면 먼저 버림 (한 ID가 두 프레임에 매핑되지 않게)
+        DropStaleFrame(new_page_id);
 
         FrameId frame_id;
         if (!FindFreeFrameFromVictim(&frame_id)) {
+            // 못 쓴 ID는 돌려줌
+            if (temp) {
+                disk_manager_->DeallocateTempPage(new_page_id);
+            } else {
+                disk_manager_->DeallocatePage(new_page_id);
+            }
             return nullptr;
         }
 
-        // 새 페이지 할당 = 디스크 관련 작업이므로, 디스크 매니저에게
-        PageId new_page_id = disk_manager_->AllocatePage();
+        metrics_.new_pages.Add();
         *page_id = new_page_id;
+        if (trace_ != nullptr) {
+            trace_->Record(TraceEventType::NEW_PAGE, new_page_id);
+        }
 
         // 새 페이지를 만들고, 버퍼 풀에 저장
         // 메모리 프레임 세팅
         Page& page = pages_[frame_id];
+        FrameMeta& meta = frames_[frame_id];
 
-        if (page.page_id_ != INVALID_PAGE_ID) {
-            page_table_.erase(page.page_id_);
+        if (meta.page_id_ != INVALID_PAGE_ID) {
+            page_table_.erase(meta.page_id_);
         }
 
         // 새 페이지 세팅
         page.reset(); // 데이터 0으로 초기화
-        page.page_id_ = new_page_id;
-        page.pin_count_ = 1;
-        page.is_dirty_ = false;
+        page.set_page_id(new_page_id);
+        meta.page_id_ = new_page_id;
+        meta.pin_count_ = 1;
+        meta.is_dirty_ = false;
+        meta.rec_lsn_ = INVALID_LSN;
+        meta.last_access_ = ++access_clock_;
+        meta.prewarmed_ = false;
+        TrackRecLsn(meta);
 
         // 테이블 등록
         page_table_[new_page_id] = frame_id;
@@ -150,6 +381,298 @@ namespace mydb {
         return &page;
     }
 
+    bool BufferPoolManager::DeletePage(PageId page_id) {
+        return DeletePageImpl(page_id, false);
+    }
+
+    bool BufferPoolManager::DeleteTempPage(PageId page_id) {
+        return DeletePageImpl(page_id, true);
+    }
+
+    bool BufferPoolManager::DeletePageImpl(PageId page_id, bool temp) {
+        if (read_only_) {
+            return false;
+        }
+        // 프레임을 비우기 전에 확인 (DeallocatePage가 거부할 페이지의 데이터를 버리지 않게)
+        if (!temp && disk_manager_->IsTempPage(page_id)) {
+            spdlog::warn("DeletePage: page {} is a temporary page (use DeleteTempPage)", page_id);
+            return false;
+        }
+
+        auto lock = LockPool();
+
+        auto iter = page_table_.find(page_id);
+        if (iter != page_table_.end()) {
+            FrameId frame_id = iter->second;
+            FrameMeta& meta = frames_[frame_id];
+
+            // 누가 쓰고 있으면 지울 수 없음
+            if (meta.pin_count_ > 0) {
+                return false;
+            }
+
+            // 버려질 페이지이므로 dirty여도 디스크에 쓰지 않음
+            BumpPageEpoch(page_id);
+            page_table_.erase(iter);
+            replacer_->Pin(frame_id); // 교체 후보에서 제외 (free_list_로 감)
+            ReleaseFrame(frame_id);
+            if (trace_ != nullptr) {
+                trace_->Record(TraceEventType::DELETE, page_id);
+            }
+        }
+
+        /* 페이지 ID 반납도 락 안에서: 프레임을 비운 뒤 반납 전에 다른 스레드가 FetchPage로 다시 올리면
+         * 반납된 ID의 프레임이 남게 됨. 이미 반납됐거나 할당된 적 없는 ID면 false (free list에 두 번 들어가지 않음)
+         */
+        return temp ? disk_manager_->DeallocateTempPage(page_id) : disk_manager_->DeallocatePage(page_id);
+    }
+
+    void BufferPoolManager::AdviseAccess(AccessPattern pattern, PageId first, PageId count) {
+        if (read_only_) {
+            disk_manager_->AdviseMapping(pattern, first, count);
+        }
+    }
+
+    Page* BufferPoolManager::FetchMappedPage(PageId page_id) {
+        const char* data = disk_manager_->GetMappedPage(page_id);
+        if (data == nullptr) {
+            return nullptr; // 매핑 범위 밖
+        }
+
+        // 처음 접근할 때 한 번만 검증. 두 스레드가 동시에 검증해도 결과는 같으므로 락 없이 처리
+        std::atomic<uint64_t>& word = verified_[page_id / 64];
+        uint64_t bit = 1ULL << (page_id % 64);
+        if ((word.load(std::memory_order_acquire) & bit) == 0) {
+            DiskManager::VerifyChecksum(page_id, data); // 손상됐으면 로그를 남기고 PageCorruptionError
+            word.fetch_or(bit, std::memory_order_release);
+        }
+
+        // 매핑은 PROT_READ: 읽기만 가능
+        return reinterpret_cast<Page*>(const_cast<char*>(data));
+    }
+
+    std::vector<PageId> BufferPoolManager::GetResidentPages() {
+        std::vector<std::pair<uint64_t, PageId>> resident;
+        {
+            auto lock = LockPool();
+            resident.reserve(page_table_.size());
+            for (size_t i = 0; i < pool_size_; i++) {
+                const FrameMeta& meta = frames_[i];
+                if (meta.page_id_ != INVALID_PAGE_ID) {
+                    resident.emplace_back(meta.last_access_, meta.page_id_);
+                }
+            }
+        }
+
+        // 정렬은 락 밖에서 (최근에 쓰인 것부터)
+        std::sort(resident.begin(), resident.end(), std::greater<>());
+
+        // 임시 페이지(정렬 run, spill)는 재시작 후에 쓸 일이 없고, 그때는 free list에 있는 ID임
+        std::vector<PageId> page_ids;
+        page_ids.reserve(resident.size());
+        for (const auto& [last_access, page_id] : resident) {
+            if (!disk_manager_->IsTempPage(page_id)) {
+                page_ids.push_back(page_id);
+            }
+        }
+        return page_ids;
+    }
+
+    uint64_t BufferPoolManager::GetPageEpoch() {
+        auto lock = LockPool();
+        return page_epoch_clock_;
+    }
+
+    size_t BufferPoolManager::PrewarmPages(PageId first, PageId count, const char* data, uint64_t read_epoch,
+                                           bool* pool_full) {
+        *pool_full = false;
+        if (read_only_) {
+            *pool_full = true;
+            return 0;
+        }
+
+        auto lock = LockPool();
+
+        size_t loaded = 0;
+        for (PageId i = 0; i < count; i++) {
+            PageId page_id = first + i;
+            if (page_table_.find(page_id) != page_table_.end()) {
+                continue; // 트래픽이 먼저 올렸음 (메모리 쪽이 더 최신일 수 있으므로 덮어쓰지 않음)
+            }
+            if (page_epochs_[page_id % PAGE_EPOCH_SLOTS] > read_epoch) {
+                continue; // 읽은 뒤 트래픽이 올렸다가 내보냈음 (디스크 쪽이 data보다 최신일 수 있음)
+            }
+            if (disk_manager_->get_allocator().IsFree(page_id) || disk_manager_->IsTempPage(page_id)) {
+                continue; // 스냅샷 이후 반납됐거나 임시 페이지 (올려두면 NewPage가 같은 ID를 다시 내줄 때 옛 프레임이 남음)
+            }
+            if (free_list_.empty()) {
+                *pool_full = true;
+                break;
+            }
+
+            FrameId frame_id = free_list_.front();
+            free_list_.pop_front();
+
+            Page& page = pages_[frame_id];
+            std::memcpy(page.get_data(), data + static_cast<size_t>(i) * PAGE_SIZE, PAGE_SIZE);
+            page.set_page_id(page_id);
+
+            FrameMeta& meta = frames_[frame_id];
+            meta.page_id_ = page_id;
+            meta.pin_count_ = 0;
+            meta.is_dirty_ = false;
+            meta.rec_lsn_ = INVALID_LSN;
+            meta.last_access_ = 0; // 실제로 요청되기 전까지는 가장 오래된 것으로 취급
+            meta.prewarmed_ = true;
+
+            page_table_[page_id] = frame_id;
+            replacer_->UnpinCold(frame_id); // 트래픽이 쓰던 페이지보다 먼저 쫓겨나게
+            loaded++;
+        }
+
+        metrics_.prewarmed_pages.Add(loaded);
+        return loaded;
+    }
+
+    BufferPoolMetricsSnapshot BufferPoolManager::GetMetricsSnapshot() const {
+        BufferPoolMetricsSnapshot snapshot;
+        snapshot.taken_at = std::chrono::steady_clock::now();
+
+        snapshot.fetch_hits = metrics_.fetch_hits.Load();
+        snapshot.fetch_misses = metrics_.fetch_misses.Load();
+        snapshot.new_pages = metrics_.new_pages.Load();
+        snapshot.evictions = metrics_.evictions.Load();
+        snapshot.dirty_writebacks = metrics_.dirty_writebacks.Load();
+        snapshot.prewarmed_pages = metrics_.prewarmed_pages.Load();
+        snapshot.prewarm_hits = metrics_.prewarm_hits.Load();
+        snapshot.lock_acquisitions = metrics_.lock_acquisitions.Load();
+        snapshot.lock_contentions = metrics_.lock_contentions.Load();
+        snapshot.lock_wait = metrics_.lock_wait.Snapshot();
+
+        const DiskMetrics& disk = disk_manager_->get_metrics();
+        snapshot.pages_read = disk.pages_read.Load();
+        snapshot.pages_written = disk.pages_written.Load();
+        snapshot.read_latency = disk.read_latency.Snapshot();
+        snapshot.batch_read_latency = disk.batch_read_latency.Snapshot();
+        snapshot.write_latency = disk.write_latency.Snapshot();
+        return snapshot;
+    }
+
+    double BufferPoolMetricsSnapshot::HitRatio() const {
+        uint64_t total = fetch_hits + fetch_misses;
+        return total == 0 ? 0.0 : static_cast<double>(fetch_hits) / static_cast<double>(total);
+    }
+
+    BufferPoolMetricsSnapshot BufferPoolMetricsSnapshot::Since(const BufferPoolMetricsSnapshot& earlier) const {
+        BufferPoolMetricsSnapshot diff;
+        diff.taken_at = taken_at;
+        diff.fetch_hits = fetch_hits - earlier.fetch_hits;
+        diff.fetch_misses = fetch_misses - earlier.fetch_misses;
+        diff.new_pages = new_pages - earlier.new_pages;
+        diff.evictions = evictions - earlier.evictions;
+        diff.dirty_writebacks = dirty_writebacks - earlier.dirty_writebacks;
+        diff.prewarmed_pages = prewarmed_pages - earlier.prewarmed_pages;
+        diff.prewarm_hits = prewarm_hits - earlier.prewarm_hits;
+        diff.lock_acquisitions = lock_acquisitions - earlier.lock_acquisitions;
+        diff.lock_contentions = lock_contentions - earlier.lock_contentions;
+        diff.lock_wait = lock_wait.Since(earlier.lock_wait);
+        diff.pages_read = pages_read - earlier.pages_read;
+        diff.pages_written = pages_written - earlier.pages_written;
+        diff.read_latency = read_latency.Since(earlier.read_latency);
+        diff.batch_read_latency = batch_read_latency.Since(earlier.batch_read_latency);
+        diff.write_latency = write_latency.Since(earlier.write_latency);
+        return diff;
+    }
+
+    void BufferPoolManager::StartTrace(const std::string& path) {
+        if (read_only_) {
+            throw std::runtime_error("Access trace is not supported in read-only mmap mode");
+        }
+
+        // 파일 열기는 락 밖에서 (실패하면 기존 트레이스는 그대로 유지)
+        auto trace = std::make_unique<TraceWriter>(path);
+
+        auto lock = LockPool();
+        if (trace_ != nullptr) {
+            trace_->Flush();
+        }
+        trace_ = std::move(trace);
+        spdlog::info("BufferPoolManager: access trace started ({})", path);
+    }
+
+    uint64_t BufferPoolManager::StopTrace() {
+        std::unique_ptr<TraceWriter> trace;
+        {
+            auto lock = LockPool();
+            trace = std::move(trace_);
+        }
+        if (trace == nullptr) {
+            return 0;
+        }
+
+        trace->Flush();
+        spdlog::info("BufferPoolManager: access trace stopped ({} events)", trace->get_num_events());
+        return trace->get_num_events();
+    }
+
+    std::unique_lock<std::mutex> BufferPoolManager::LockPool() {
+        metrics_.lock_acquisitions.Add();
+
+        std::unique_lock lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            metrics_.lock_contentions.Add();
+            ScopedLatencyTimer timer(metrics_.lock_wait);
+            lock.lock();
+        }
+        return lock;
+    }
+
+    // 헬퍼 함수: 페이지 적재에 실패한 프레임을 빈 프레임으로 되돌림
+    void BufferPoolManager::ReleaseFrame(FrameId frame_id) {
+        FrameMeta& meta = frames_[frame_id];
+        meta.page_id_ = INVALID_PAGE_ID;
+        meta.pin_count_ = 0;
+        meta.is_dirty_ = false;
+        meta.rec_lsn_ = INVALID_LSN;
+        meta.prewarmed_ = false;
+        free_list_.push_back(frame_id);
+    }
+
+    // 헬퍼 함수: clean 페이지가 pin될 때, 앞으로 생길 수정의 LSN 하한을 기록
+    // (수정은 pin한 다음에 로그를 남기므로, 지금의 로그 끝 이후의 LSN을 받게 됨)
+    void BufferPoolManager::TrackRecLsn(FrameMeta& meta) {
+        if (log_manager_ != nullptr && !meta.is_dirty_ && meta.rec_lsn_ == INVALID_LSN) {
+            meta.rec_lsn_ = log_manager_->GetNextLsn();
+        }
+    }
+
+    // 헬퍼 함수: 새로 받은 ID가 (반납 전의 내용으로) 아직 프레임에 있으면 매핑을 지우고 프레임을 비움
+    void BufferPoolManager::DropStaleFrame(PageId page_id) {
+        auto iter = page_table_.find(page_id);
+        if (iter == page_table_.end()) {
+            return;
+        }
+
+        FrameId frame_id = iter->second;
+        FrameMeta& meta = frames_[frame_id];
+        BumpPageEpoch(page_id);
+        page_table_.erase(iter);
+
+        if (meta.pin_count_ > 0) {
+            // 반납된 페이지를 누가 아직 잡고 있음 (호출한 쪽 오류). 그 프레임은 pin이 풀려도 다시 쓰지 않음
+            spdlog::error("NewPage: reused page {} is still pinned by a stale reference", page_id);
+            meta.page_id_ = INVALID_PAGE_ID;
+            return;
+        }
+        replacer_->Pin(frame_id);
+        ReleaseFrame(frame_id);
+    }
+
+    // 헬퍼 함수: 쫓겨나거나 삭제되는 페이지의 epoch 칸 갱신
+    void BufferPoolManager::BumpPageEpoch(PageId page_id) {
+        page_epochs_[page_id % PAGE_EPOCH_SLOTS] = ++page_epoch_clock_;
+    }
+
     // 헬퍼 함수: 빈 프레임 찾기 (FreeList - LRU list 순으로 탐색)
     bool BufferPoolManager::FindFreeFrameFromVictim(FrameId* frame_id) {
         // Free List에 빈 공간 있는지 체크
@@ -162,10 +685,18 @@ namespace mydb {
         // 없으면 LRU Replacer에게 victim 결정 요청
         if (replacer_->Victim(frame_id)) {
             Page& victim_page = pages_[*frame_id];
+            FrameMeta& victim_meta = frames_[*frame_id];
+            metrics_.evictions.Add();
+            BumpPageEpoch(victim_meta.page_id_);
             // victim이 디스크에 저장하지 않은 수정사항을 갖고 있으면, 기록
-            if (victim_page.is_dirty_) {
-                disk_manager_->WritePage(victim_page.page_id_, victim_page);
-                victim_page.is_dirty_ = false;
+            if (victim_meta.is_dirty_) {
+                metrics_.dirty_writebacks.Add();
+                // WAL: 이 페이지를 바꾼 로그 레코드가 전부 영속화된 뒤에만 페이지를 쓸 수 있음
+                if (log_manager_ != nullptr) {
+                    log_manager_->Flush(victim_page.get_lsn());
+                }
+                disk_manager_->WritePage(victim_meta.page_id_, victim_page);
+                victim_meta.is_dirty_ = false;
             }
             // 테이블에서 제거는 호출한 쪽에서 처리 (여기선 프레임 확보만)
             return true;
@@ -0,0 +1,260 @@
+#include "mydb/buffer/BufferPoolWarmer.hpp"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "mydb/common/Crc32c.hpp"
+
+namespace mydb {
+
+    namespace {
+        // 스냅샷 파일: [magic 8][version 4][count 4][crc32c 4][PageId x count]
+        constexpr char WARM_MAGIC[8] = {'M', 'Y', 'D', 'B', 'W', 'R', 'M', '\0'};
+        constexpr uint32_t WARM_VERSION = 2; // 2: PageId 8바이트
+        constexpr size_t WARM_HEADER_SIZE = sizeof(WARM_MAGIC) + sizeof(uint32_t) * 3;
+    }
+
+    BufferPoolWarmer::BufferPoolWarmer(BufferPoolManager* bpm, DiskManager* disk_manager, WarmupOptions options)
+        : bpm_(bpm), disk_manager_(disk_manager), options_(std::move(options)) {
+        if (options_.snapshot_path.empty()) {
+            options_.snapshot_path =
+                std::filesystem::path(disk_manager_->get_file_name()).replace_extension(".warm").string();
+        }
+        if (options_.max_batch_pages == 0) {
+            options_.max_batch_pages = 1;
+        }
+    }
+
+    BufferPoolWarmer::~BufferPoolWarmer() {
+        cancel_warmup_.store(true, std::memory_order_relaxed);
+        if (warmup_thread_.joinable()) {
+            warmup_thread_.join();
+        }
+        Stop();
+    }
+
+    void BufferPoolWarmer::Start() {
+        std::scoped_lock lock(mutex_);
+        if (running_) {
+            return;
+        }
+        running_ = true;
+        snapshot_thread_ = std::thread(&BufferPoolWarmer::SnapshotThreadMain, this);
+    }
+
+    void BufferPoolWarmer::Stop() {
+        bool was_running;
+        {
+            std::scoped_lock lock(mutex_);
+            was_running = running_;
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        if (snapshot_thread_.joinable()) {
+            snapshot_thread_.join();
+        }
+
+        // 정상 종료 직전의 상주 페이지가 다음 워밍업에 가장 유용함
+        if (was_running) {
+            SaveSnapshot();
+        }
+    }
+
+    void BufferPoolWarmer::SnapshotThreadMain() {
+        std::unique_lock lock(mutex_);
+
+        while (running_) {
+            if (cv_.wait_for(lock, options_.snapshot_interval, [&] { return !running_; })) {
+                break;
+            }
+
+            lock.unlock();
+            try {
+                SaveSnapshot();
+            } catch (const std::exception& e) {
+                // 스냅샷은 힌트일 뿐이므로, 실패해도 다음 주기에 다시 시도
+                spdlog::warn("BufferPoolWarmer: failed to save snapshot: {}", e.what());
+            }
+            lock.lock();
+        }
+    }
+
+    size_t BufferPoolWarmer::SaveSnapshot() {
+        std::vector<PageId> page_ids = bpm_->GetResidentPages();
+
+        std::scoped_lock lock(snapshot_mutex_);
+
+        // 쓰다가 죽어도 이전 스냅샷이 남도록 임시 파일에 쓰고 rename
+        std::string tmp_path = options_.snapshot_path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                throw std::runtime_error("Failed to open warm snapshot file: " + tmp_path +
+                                         " | Error: " + std::strerror(errno));
+            }
+
+            auto count = static_cast<uint32_t>(page_ids.size());
+            uint32_t crc = Crc32c(reinterpret_cast<const char*>(page_ids.data()), page_ids.size() * sizeof(PageId));
+
+            out.write(WARM_MAGIC, sizeof(WARM_MAGIC));
+            out.write(reinterpret_cast<const char*>(&WARM_VERSION), sizeof(WARM_VERSION));
+            out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            out.write(reinterpret_cast<const char*>(&crc), sizeof(crc));
+            out.write(reinterpret_cast<const char*>(page_ids.data()),
+                      static_cast<std::streamsize>(page_ids.size() * sizeof(PageId)));
+            if (!out.good()) {
+                throw std::runtime_error("Failed to write warm snapshot file: " + tmp_path);
+            }
+        }
+        std::filesystem::rename(tmp_path, options_.snapshot_path);
+
+        spdlog::debug("BufferPoolWarmer: saved {} resident pages to {}", page_ids.size(), options_.snapshot_path);
+        return page_ids.size();
+    }
+
+    std::vector<PageId> BufferPoolWarmer::LoadSnapshot(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) {
+            return {};
+        }
+
+        char header[WARM_HEADER_SIZE];
+        if (!in.read(header, sizeof(header))) {
+            spdlog::warn("BufferPoolWarmer: snapshot {} is truncated, ignoring", path);
+            return {};
+        }
+
+        uint32_t version;
+        uint32_t count;
+        uint32_t crc;
+        std::memcpy(&version, header + sizeof(WARM_MAGIC), sizeof(version));
+        std::memcpy(&count, header + sizeof(WARM_MAGIC) + 4, sizeof(count));
+        std::memcpy(&crc, header + sizeof(WARM_MAGIC) + 8, sizeof(crc));
+        if (std::memcmp(header, WARM_MAGIC, sizeof(WARM_MAGIC)) != 0 || version != WARM_VERSION) {
+            spdlog::warn("BufferPoolWarmer: {} is not a warm snapshot, ignoring", path);
+            return {};
+        }
+
+        std::vector<PageId> page_ids(count);
+        if (!in.read(reinterpret_cast<char*>(page_ids.data()), static_cast<std::streamsize>(count * sizeof(PageId))) ||
+            Crc32c(reinterpret_cast<const char*>(page_ids.data()), page_ids.size() * sizeof(PageId)) != crc) {
+            spdlog::warn("BufferPoolWarmer: snapshot {} is corrupted, ignoring", path);
+            return {};
+        }
+        return page_ids;
+    }
+
+    void BufferPoolWarmer::StartWarmup() {
+        if (warmup_thread_.joinable()) {
+            return; // 워밍업은 시작할 때 한 번만
+        }
+        cancel_warmup_.store(false, std::memory_order_relaxed);
+        warmup_thread_ = std::thread(&BufferPoolWarmer::WarmupThreadMain, this);
+    }
+
+    WarmupStats BufferPoolWarmer::WaitForWarmup() {
+        if (warmup_thread_.joinable()) {
+            warmup_thread_.join();
+        }
+        return GetWarmupStats();
+    }
+
+    WarmupStats BufferPoolWarmer::GetWarmupStats() {
+        std::scoped_lock lock(mutex_);
+        return warmup_stats_;
+    }
+
+    void BufferPoolWarmer::WarmupThreadMain() {
+        auto start = std::chrono::steady_clock::now();
+        WarmupStats stats;
+
+        // 풀에 다 들어가지 않으면 최근에 쓰인 쪽만
+        std::vector<PageId> page_ids = LoadSnapshot(options_.snapshot_path);
+        if (page_ids.size() > bpm_->get_pool_size()) {
+            page_ids.resize(bpm_->get_pool_size());
+        }
+        stats.snapshot_pages = page_ids.size();
+
+        // ID 순으로 정렬해서 연속 구간을 한 번의 순차 읽기로 묶음
+        std::sort(page_ids.begin(), page_ids.end());
+        page_ids.erase(std::unique(page_ids.begin(), page_ids.end()), page_ids.end());
+
+        std::vector<char> buffer(static_cast<size_t>(options_.max_batch_pages) * PAGE_SIZE);
+        size_t i = 0;
+        while (i < page_ids.size() && !cancel_warmup_.load(std::memory_order_relaxed)) {
+            PageId first = page_ids[i];
+            PageId count = 1;
+            while (i + count < page_ids.size() && count < options_.max_batch_pages &&
+                   page_ids[i + count] == first + count) {
+                count++;
+            }
+            i += count;
+
+            bool pool_full = !LoadRun(first, count, buffer, stats);
+
+            // 진행 상황을 워밍업 도중에도 볼 수 있게
+            {
+                std::scoped_lock lock(mutex_);
+                warmup_stats_ = stats;
+            }
+            if (pool_full) {
+                break; // 빈 프레임이 없음: 트래픽이 풀을 채웠으므로 더 올릴 필요가 없음
+            }
+        }
+
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        stats.done = true;
+        {
+            std::scoped_lock lock(mutex_);
+            warmup_stats_ = stats;
+        }
+
+        spdlog::info("BufferPoolWarmer: warmed {} of {} pages in {} batches ({} ms)",
+                     stats.loaded_pages, stats.snapshot_pages, stats.batches, stats.duration.count() / 1000);
+    }
+
+    bool BufferPoolWarmer::LoadRun(PageId first, PageId count, std::vector<char>& buffer, WarmupStats& stats) {
+        // 읽는 사이 트래픽이 고쳐서 다시 쓴 페이지를 옛 이미지로 올리지 않게, 읽기 전의 epoch를 같이 넘김
+        uint64_t read_epoch = bpm_->GetPageEpoch();
+        PageId read = disk_manager_->ReadPages(first, count, buffer.data());
+        stats.batches++;
+        stats.skipped_pages += count - read; // 파일 끝을 넘는 페이지 (스냅샷 이후 파일이 줄어든 경우)
+
+        // 체크섬이 맞는 구간만 올림 (손상된 페이지는 나중에 FetchPage가 직접 읽을 때 에러를 냄)
+        PageId valid_begin = 0;
+        for (PageId j = 0; j <= read; j++) {
+            bool valid = false;
+            if (j < read) {
+                try {
+                    DiskManager::VerifyChecksum(first + j, buffer.data() + static_cast<size_t>(j) * PAGE_SIZE);
+                    valid = true;
+                } catch (const PageCorruptionError&) {
+                    stats.skipped_pages++;
+                }
+            }
+            if (valid) {
+                continue;
+            }
+
+            if (j > valid_begin) {
+                bool pool_full;
+                PageId run = j - valid_begin;
+                size_t loaded = bpm_->PrewarmPages(first + valid_begin, run,
+                                                   buffer.data() + static_cast<size_t>(valid_begin) * PAGE_SIZE,
+                                                   read_epoch, &pool_full);
+                stats.loaded_pages += loaded;
+                if (pool_full) {
+                    return false;
+                }
+                stats.skipped_pages += run - loaded;
+            }
+            valid_begin = j + 1;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,77 @@
+#include "mydb/buffer/ClockReplacer.hpp"
+
+namespace mydb {
+
+    ClockReplacer::ClockReplacer(size_t num_pages) : entries_(num_pages) {}
+
+    bool ClockReplacer::Victim(FrameId* frame_id) {
+        std::scoped_lock lock(mutex_);
+
+        if (size_ == 0) {
+            return false;
+        }
+
+        // 후보가 하나라도 있으면 최대 두 바퀴 안에 찾음 (첫 바퀴에 참조 비트를 모두 끄므로)
+        while (true) {
+            Entry& entry = entries_[hand_];
+            size_t current = hand_;
+            hand_ = (hand_ + 1) % entries_.size();
+
+            if (!entry.in_replacer_) {
+                continue;
+            }
+            if (entry.referenced_) {
+                entry.referenced_ = false; // second chance
+                continue;
+            }
+
+            entry.in_replacer_ = false;
+            size_--;
+            *frame_id = static_cast<FrameId>(current);
+            return true;
+        }
+    }
+
+    void ClockReplacer::Pin(FrameId frame_id) {
+        std::scoped_lock lock(mutex_);
+
+        if (frame_id >= entries_.size() || !entries_[frame_id].in_replacer_) {
+            return;
+        }
+        entries_[frame_id].in_replacer_ = false;
+        size_--;
+    }
+
+    void ClockReplacer::Unpin(FrameId frame_id) {
+        std::scoped_lock lock(mutex_);
+
+        if (frame_id >= entries_.size()) {
+            return;
+        }
+
+        Entry& entry = entries_[frame_id];
+        entry.referenced_ = true;
+        if (!entry.in_replacer_) {
+            entry.in_replacer_ = true;
+            size_++;
+        }
+    }
+
+    void ClockReplacer::UnpinCold(FrameId frame_id) {
+        std::scoped_lock lock(mutex_);
+
+        if (frame_id >= entries_.size() || entries_[frame_id].in_replacer_) {
+            return;
+        }
+
+        // 참조 비트를 켜지 않음: 바늘이 처음 만날 때 바로 victim
+        entries_[frame_id].in_replacer_ = true;
+        entries_[frame_id].referenced_ = false;
+        size_++;
+    }
+
+    size_t ClockReplacer::Size() {
+        std::scoped_lock lock(mutex_);
+        return size_;
+    }
+}
@@ -0,0 +1,129 @@
+#include "mydb/buffer/FrameArena.hpp"
+
+#include <spdlog/spdlog.h>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <linux/mempolicy.h> // MPOL_* (libnuma 없이 mbind 시스템 콜을 직접 호출)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace mydb {
+
+    namespace {
+        // x86-64 기본 huge page 크기. MAP_HUGETLB는 길이가 이 단위의 배수여야 함
+        constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+        // mbind에 넘길 노드 마스크 (최대 64개 노드)
+        constexpr size_t MAX_NUMA_NODES = sizeof(unsigned long) * 8;
+
+        // 온라인 NUMA 노드 목록 읽기 ("0-3,5" 형식). 읽을 수 없으면 0
+        unsigned long ReadOnlineNodeMask() {
+            std::ifstream in("/sys/devices/system/node/online");
+            std::string line;
+            if (!in.is_open() || !std::getline(in, line)) {
+                return 0;
+            }
+
+            unsigned long mask = 0;
+            std::stringstream ss(line);
+            std::string range;
+            while (std::getline(ss, range, ',')) {
+                size_t dash = range.find('-');
+                try {
+                    size_t first = std::stoul(range.substr(0, dash));
+                    size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+                    for (size_t node = first; node <= last && node < MAX_NUMA_NODES; node++) {
+                        mask |= 1UL << node;
+                    }
+                } catch (const std::exception&) {
+                    return 0;
+                }
+            }
+            return mask;
+        }
+    }
+
+    FrameArena::FrameArena(size_t size, const FrameArenaOptions& options) : size_(size) {
+        map_size_ = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        if (map_size_ == 0) {
+            map_size_ = HUGE_PAGE_SIZE;
+        }
+
+        void* addr = MAP_FAILED;
+
+        // 1. 미리 예약된 huge page (vm.nr_hugepages가 부족하면 실패하므로 아래로 대체)
+        // MAP_NORESERVE를 붙이면 예약 없이 매핑만 성공하고 첫 접근 때 SIGBUS가 나므로, 여기서는 예약을 요구함
+        if (options.use_huge_pages) {
+            addr = ::mmap(nullptr, map_size_, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            huge_tlb_ = addr != MAP_FAILED;
+        }
+
+        // 2. 일반 익명 매핑 + transparent huge page 요청
+        if (addr == MAP_FAILED) {
+            addr = ::mmap(nullptr, map_size_, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (addr == MAP_FAILED) {
+                throw std::runtime_error("Failed to map buffer pool frames (" + std::to_string(map_size_) +
+                                         " bytes) | Error: " + std::strerror(errno));
+            }
+            if (options.use_huge_pages) {
+                // THP가 꺼져 있으면 실패하지만, 일반 페이지로 동작하므로 무시
+                ::madvise(addr, map_size_, MADV_HUGEPAGE);
+            }
+        }
+
+        data_ = static_cast<char*>(addr);
+
+        // 아직 아무 페이지도 fault되지 않았으므로, 정책은 이후 첫 접근 시 적용됨
+        if (options.numa_policy != NumaPolicy::DEFAULT) {
+            numa_applied_ = ApplyNumaPolicy(options);
+        }
+
+        spdlog::debug("FrameArena: {} bytes mapped (hugetlb: {}, numa policy applied: {})",
+                      map_size_, huge_tlb_, numa_applied_);
+    }
+
+    FrameArena::~FrameArena() {
+        if (data_ != nullptr) {
+            ::munmap(data_, map_size_);
+        }
+    }
+
+    bool FrameArena::ApplyNumaPolicy(const FrameArenaOptions& options) {
+        unsigned long online = ReadOnlineNodeMask();
+        if (online == 0) {
+            spdlog::warn("FrameArena: NUMA topology unavailable, ignoring NUMA policy");
+            return false;
+        }
+
+        int mode;
+        unsigned long nodemask;
+        if (options.numa_policy == NumaPolicy::BIND) {
+            if (options.numa_node < 0 || static_cast<size_t>(options.numa_node) >= MAX_NUMA_NODES ||
+                (online & (1UL << options.numa_node)) == 0) {
+                spdlog::warn("FrameArena: NUMA node {} is not online, ignoring NUMA policy", options.numa_node);
+                return false;
+            }
+            mode = MPOL_BIND;
+            nodemask = 1UL << options.numa_node;
+        } else {
+            mode = MPOL_INTERLEAVE;
+            nodemask = online;
+        }
+
+        // maxnode는 커널이 1을 빼고 해석하므로 비트 수 + 1
+        long ret = ::syscall(SYS_mbind, data_, map_size_, mode, &nodemask, MAX_NUMA_NODES + 1, 0);
+        if (ret != 0) {
+            spdlog::warn("FrameArena: mbind failed: {}", std::strerror(errno));
+            return false;
+        }
+        return true;
+    }
+}
@@ -60,6 +60,18 @@ namespace mydb {
         lru_map_[frame_id] = std::prev(lru_list_.end());
     }
 
+    void LRUReplacer::UnpinCold(FrameId frame_id) {
+        std::scoped_lock lock(mutex_);
+
+        if (lru_map_.find(frame_id) != lru_map_.end() || lru_list_.size() >= num_pages_) {
+            return;
+        }
+
+        lru_list_.push_front(frame_id); // 가장 오래된 것으로 취급해서, 맨 앞에 추가
+
+        lru_map_[frame_id] = lru_list_.begin();
+    }
+
     size_t LRUReplacer::Size() {
         std::scoped_lock lock(mutex_);
         return lru_list_.size();
@@ -0,0 +1,91 @@
+#include "mydb/buffer/MetricsReporter.hpp"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+namespace mydb {
+
+    MetricsReporter::MetricsReporter(BufferPoolManager* bpm, std::chrono::milliseconds interval)
+        : bpm_(bpm), interval_(interval), last_(bpm->GetMetricsSnapshot()) {}
+
+    MetricsReporter::~MetricsReporter() {
+        Stop();
+    }
+
+    void MetricsReporter::Start() {
+        std::scoped_lock lock(mutex_);
+        if (running_) {
+            return;
+        }
+        running_ = true;
+        thread_ = std::thread(&MetricsReporter::ThreadMain, this);
+    }
+
+    void MetricsReporter::Stop() {
+        {
+            std::scoped_lock lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    void MetricsReporter::ThreadMain() {
+        std::unique_lock lock(mutex_);
+
+        while (running_) {
+            if (cv_.wait_for(lock, interval_, [&] { return !running_; })) {
+                break;
+            }
+
+            lock.unlock();
+            Report();
+            lock.lock();
+        }
+    }
+
+    std::string MetricsReporter::Report() {
+        BufferPoolMetricsSnapshot now = bpm_->GetMetricsSnapshot();
+
+        BufferPoolMetricsSnapshot interval;
+        double seconds;
+        {
+            std::scoped_lock lock(mutex_);
+            interval = now.Since(last_);
+            seconds = std::chrono::duration<double>(now.taken_at - last_.taken_at).count();
+            last_ = now;
+        }
+
+        std::string line = Format(interval, seconds);
+        spdlog::info("{}", line);
+        return line;
+    }
+
+    std::string MetricsReporter::Format(const BufferPoolMetricsSnapshot& interval, double seconds) {
+        auto rate = [&](uint64_t n) { return seconds > 0 ? static_cast<double>(n) / seconds : 0.0; };
+        auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+
+        std::string line = fmt::format(
+            "BufferPool: fetch {:.0f}/s (hit {:.1f}%), new {:.0f}/s, evict {:.0f}/s (dirty {:.0f}/s) | "
+            "read {:.0f}/s p50 {:.1f}us p99 {:.1f}us max {:.1f}us | "
+            "write {:.0f}/s p50 {:.1f}us p99 {:.1f}us max {:.1f}us | "
+            "lock contended {}/{} p99 {:.1f}us max {:.1f}us",
+            rate(interval.fetch_hits + interval.fetch_misses), interval.HitRatio() * 100.0,
+            rate(interval.new_pages), rate(interval.evictions), rate(interval.dirty_writebacks),
+            rate(interval.pages_read), us(interval.read_latency.Percentile(50)),
+            us(interval.read_latency.Percentile(99)), us(interval.read_latency.Max()),
+            rate(interval.pages_written), us(interval.write_latency.Percentile(50)),
+            us(interval.write_latency.Percentile(99)), us(interval.write_latency.Max()),
+            interval.lock_contentions, interval.lock_acquisitions,
+            us(interval.lock_wait.Percentile(99)), us(interval.lock_wait.Max()));
+
+        // 재시작 후 워밍업 구간에만 붙음
+        if (interval.prewarmed_pages > 0 || interval.prewarm_hits > 0) {
+            line += fmt::format(" | prewarm loaded {} used {}", interval.prewarmed_pages, interval.prewarm_hits);
+        }
+        return line;
+    }
+}
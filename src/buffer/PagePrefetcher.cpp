@@ -0,0 +1,99 @@
+#include "mydb/buffer/PagePrefetcher.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mydb {
+
+    PagePrefetcher::PagePrefetcher(BufferPoolManager* bpm) : bpm_(bpm) {
+        thread_ = std::thread(&PagePrefetcher::ThreadMain, this);
+    }
+
+    PagePrefetcher::~PagePrefetcher() {
+        {
+            std::scoped_lock lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    PagePrefetcher::Handle PagePrefetcher::Request(PageId page_id) {
+        auto request = std::make_shared<PrefetchRequest>();
+        request->page_id_ = page_id;
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.push_back(request);
+        }
+        cv_.notify_one();
+        return request;
+    }
+
+    Page* PagePrefetcher::Take(const Handle& request) {
+        std::unique_lock lock(mutex_);
+        if (request->state_ != PrefetchRequest::State::DONE) {
+            num_waits_++;
+            done_cv_.wait(lock, [&] { return request->state_ == PrefetchRequest::State::DONE; });
+        }
+        if (request->error_) {
+            std::rethrow_exception(request->error_);
+        }
+        if (request->page_ == nullptr) {
+            throw std::runtime_error("PagePrefetcher: no free frame for page " + std::to_string(request->page_id_));
+        }
+        return std::exchange(request->page_, nullptr);
+    }
+
+    void PagePrefetcher::Cancel(const Handle& request) {
+        std::unique_lock lock(mutex_);
+        if (request->state_ == PrefetchRequest::State::QUEUED) {
+            // 대기열에 남아 있으면 스레드가 꺼낼 때 건너뜀
+            request->state_ = PrefetchRequest::State::CANCELLED;
+            return;
+        }
+        done_cv_.wait(lock, [&] { return request->state_ != PrefetchRequest::State::LOADING; });
+        if (request->page_ != nullptr) {
+            bpm_->UnpinPage(request->page_id_, false);
+            request->page_ = nullptr;
+        }
+        request->state_ = PrefetchRequest::State::CANCELLED;
+    }
+
+    void PagePrefetcher::ThreadMain() {
+        std::unique_lock lock(mutex_);
+
+        while (true) {
+            cv_.wait(lock, [&] { return !running_ || !queue_.empty(); });
+            if (!running_) {
+                break;
+            }
+
+            Handle request = std::move(queue_.front());
+            queue_.pop_front();
+            if (request->state_ == PrefetchRequest::State::CANCELLED) {
+                continue;
+            }
+            request->state_ = PrefetchRequest::State::LOADING;
+
+            // 디스크 읽기는 락 밖에서 (그동안 Request/Take는 막히지 않음)
+            lock.unlock();
+            Page* page = nullptr;
+            std::exception_ptr error;
+            try {
+                page = bpm_->FetchPage(request->page_id_);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            request->page_ = page;
+            request->error_ = error;
+            request->state_ = PrefetchRequest::State::DONE;
+            done_cv_.notify_all();
+        }
+    }
+}
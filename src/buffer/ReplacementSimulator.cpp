@@ -0,0 +1,132 @@
+#include "mydb/buffer/ReplacementSimulator.hpp"
+
+namespace mydb {
+
+    ReplacementSimulator::ReplacementSimulator(ReplacerType policy, size_t pool_size)
+        : replacer_(MakeReplacer(policy, pool_size)), frames_(pool_size) {
+        result_.policy = policy;
+        result_.pool_size = pool_size;
+
+        // BufferPoolManager의 free_list_와 같은 순서로 사용 (CLOCK은 프레임 위치에 따라 결과가 달라짐)
+        for (size_t i = 0; i < pool_size; i++) {
+            free_frames_.push_back(static_cast<FrameId>(i));
+        }
+        page_table_.reserve(pool_size);
+    }
+
+    bool ReplacementSimulator::AcquireFrame(PageId page_id, FrameId* frame_id) {
+        if (!free_frames_.empty()) {
+            *frame_id = free_frames_.front();
+            free_frames_.pop_front();
+        } else if (replacer_->Victim(frame_id)) {
+            Frame& victim = frames_[*frame_id];
+            result_.evictions++;
+            if (victim.is_dirty_) {
+                result_.dirty_writebacks++;
+            }
+            page_table_.erase(victim.page_id_);
+        } else {
+            result_.stalls++;
+            return false;
+        }
+
+        Frame& frame = frames_[*frame_id];
+        frame.page_id_ = page_id;
+        frame.pin_count_ = 1;
+        frame.is_dirty_ = false;
+        page_table_[page_id] = *frame_id;
+        return true;
+    }
+
+    void ReplacementSimulator::DropPage(PageId page_id) {
+        auto iter = page_table_.find(page_id);
+        if (iter == page_table_.end()) {
+            return;
+        }
+        FrameId frame_id = iter->second;
+        page_table_.erase(iter);
+        replacer_->Pin(frame_id); // 교체 후보에서 제외 (free_frames_로 감)
+        frames_[frame_id] = Frame{};
+        free_frames_.push_back(frame_id);
+    }
+
+    void ReplacementSimulator::Apply(const TraceEvent& event) {
+        switch (event.type_) {
+            case TraceEventType::FETCH: {
+                result_.fetches++;
+                auto iter = page_table_.find(event.page_id_);
+                if (iter != page_table_.end()) {
+                    result_.hits++;
+                    frames_[iter->second].pin_count_++;
+                    replacer_->Pin(iter->second);
+                    return;
+                }
+
+                result_.misses++;
+                FrameId frame_id;
+                if (AcquireFrame(event.page_id_, &frame_id)) {
+                    replacer_->Pin(frame_id);
+                }
+                return;
+            }
+            case TraceEventType::NEW_PAGE: {
+                result_.new_pages++;
+                // 반납 후 재사용된 ID가 아직 프레임에 있으면 BufferPoolManager::DropStaleFrame처럼 먼저 비움
+                DropPage(event.page_id_);
+                FrameId frame_id;
+                if (AcquireFrame(event.page_id_, &frame_id)) {
+                    replacer_->Pin(frame_id);
+                }
+                return;
+            }
+            case TraceEventType::UNPIN:
+            case TraceEventType::UNPIN_DIRTY: {
+                // stall로 못 올린 페이지의 unpin은 무시
+                auto iter = page_table_.find(event.page_id_);
+                if (iter == page_table_.end()) {
+                    return;
+                }
+                Frame& frame = frames_[iter->second];
+                if (frame.pin_count_ <= 0) {
+                    return;
+                }
+                frame.is_dirty_ |= event.type_ == TraceEventType::UNPIN_DIRTY;
+                if (--frame.pin_count_ == 0) {
+                    replacer_->Unpin(iter->second);
+                }
+                return;
+            }
+            case TraceEventType::DELETE: {
+                DropPage(event.page_id_);
+                return;
+            }
+        }
+    }
+
+    std::vector<SimulationResult> ReplacementSimulator::Replay(const std::string& trace_path,
+                                                               const std::vector<ReplacerType>& policies,
+                                                               const std::vector<size_t>& pool_sizes) {
+        std::vector<ReplacementSimulator> simulators;
+        simulators.reserve(policies.size() * pool_sizes.size());
+        for (ReplacerType policy : policies) {
+            for (size_t pool_size : pool_sizes) {
+                simulators.emplace_back(policy, pool_size);
+            }
+        }
+
+        TraceReader reader(trace_path);
+        TraceEvent event;
+        while (reader.Next(&event)) {
+            for (auto& simulator : simulators) {
+                simulator.Apply(event);
+            }
+        }
+
+        std::vector<SimulationResult> results;
+        results.reserve(simulators.size());
+        for (const auto& simulator : simulators) {
+            results.push_back(simulator.get_result());
+        }
+        return results;
+    }
+}
@@ -0,0 +1,33 @@
+#include "mydb/buffer/Replacer.hpp"
+
+#include "mydb/buffer/ClockReplacer.hpp"
+#include "mydb/buffer/LRUReplacer.hpp"
+
+namespace mydb {
+
+    std::unique_ptr<Replacer> MakeReplacer(ReplacerType type, size_t num_pages) {
+        switch (type) {
+            case ReplacerType::CLOCK:
+                return std::make_unique<ClockReplacer>(num_pages);
+            case ReplacerType::LRU:
+            default:
+                return std::make_unique<LRUReplacer>(num_pages);
+        }
+    }
+
+    bool ParseReplacerType(const std::string& name, ReplacerType* type) {
+        if (name == "lru") {
+            *type = ReplacerType::LRU;
+            return true;
+        }
+        if (name == "clock") {
+            *type = ReplacerType::CLOCK;
+            return true;
+        }
+        return false;
+    }
+
+    const char* ReplacerTypeName(ReplacerType type) {
+        return type == ReplacerType::CLOCK ? "clock" : "lru";
+    }
+}
@@ -0,0 +1,122 @@
+#include "mydb/common/Crc32c.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <nmmintrin.h>
+#define MYDB_CRC32C_X86 1
+#endif
+
+namespace mydb {
+
+    namespace {
+        // CRC32C 다항식 (bit-reversed)
+        constexpr uint32_t kPolynomial = 0x82F63B78;
+
+        // slicing-by-8용 테이블: table[k][b] = 바이트 b 뒤에 0이 k바이트 더 붙었을 때의 CRC
+        constexpr std::array<std::array<uint32_t, 256>, 8> MakeTables() {
+            std::array<std::array<uint32_t, 256>, 8> table{};
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; bit++) {
+                    crc = (crc & 1) ? (crc >> 1) ^ kPolynomial : crc >> 1;
+                }
+                table[0][i] = crc;
+            }
+            for (uint32_t i = 0; i < 256; i++) {
+                for (size_t k = 1; k < 8; k++) {
+                    uint32_t prev = table[k - 1][i];
+                    table[k][i] = (prev >> 8) ^ table[0][prev & 0xFF];
+                }
+            }
+            return table;
+        }
+
+        constexpr auto kTables = MakeTables();
+
+        using Crc32cFn = uint32_t (*)(const void*, size_t, uint32_t);
+
+        Crc32cFn SelectImpl() {
+            return Crc32cHardwareAvailable() ? &Crc32cHardware : &Crc32cPortable;
+        }
+    }
+
+    uint32_t Crc32cPortable(const void* data, size_t length, uint32_t crc) {
+        const auto* p = static_cast<const uint8_t*>(data);
+        uint32_t c = ~crc;
+
+        // 8바이트씩 한 번에 처리 (little-endian 가정)
+        while (length >= 8) {
+            uint32_t lo, hi;
+            std::memcpy(&lo, p, 4);
+            std::memcpy(&hi, p + 4, 4);
+            lo ^= c;
+            c = kTables[7][lo & 0xFF] ^ kTables[6][(lo >> 8) & 0xFF] ^
+                kTables[5][(lo >> 16) & 0xFF] ^ kTables[4][lo >> 24] ^
+                kTables[3][hi & 0xFF] ^ kTables[2][(hi >> 8) & 0xFF] ^
+                kTables[1][(hi >> 16) & 0xFF] ^ kTables[0][hi >> 24];
+            p += 8;
+            length -= 8;
+        }
+
+        // 남은 바이트는 하나씩
+        while (length--) {
+            c = (c >> 8) ^ kTables[0][(c ^ *p++) & 0xFF];
+        }
+
+        return ~c;
+    }
+
+#ifdef MYDB_CRC32C_X86
+    // 이 함수만 SSE4.2 명령어로 컴파일 (빌드 옵션에 -msse4.2 없이도 사용 가능)
+    __attribute__((target("sse4.2")))
+    uint32_t Crc32cHardware(const void* data, size_t length, uint32_t crc) {
+        const auto* p = static_cast<const uint8_t*>(data);
+        uint32_t c = ~crc;
+
+#if defined(__x86_64__)
+        uint64_t c64 = c;
+        while (length >= 8) {
+            uint64_t v;
+            std::memcpy(&v, p, 8);
+            c64 = _mm_crc32_u64(c64, v);
+            p += 8;
+            length -= 8;
+        }
+        c = static_cast<uint32_t>(c64);
+#endif
+        while (length >= 4) {
+            uint32_t v;
+            std::memcpy(&v, p, 4);
+            c = _mm_crc32_u32(c, v);
+            p += 4;
+            length -= 4;
+        }
+        while (length--) {
+            c = _mm_crc32_u8(c, *p++);
+        }
+
+        return ~c;
+    }
+
+    bool Crc32cHardwareAvailable() {
+        return __builtin_cpu_supports("sse4.2");
+    }
+#else
+    // x86이 아니면 하드웨어 경로 없음 -> 포터블 구현으로 대체
+    uint32_t Crc32cHardware(const void* data, size_t length, uint32_t crc) {
+        return Crc32cPortable(data, length, crc);
+    }
+
+    bool Crc32cHardwareAvailable() {
+        return false;
+    }
+#endif
+
+    uint32_t Crc32c(const void* data, size_t length, uint32_t crc) {
+        // 최초 1회만 CPU 기능 검사 (static 지역변수 초기화는 thread-safe)
+        static const Crc32cFn impl = SelectImpl();
+        return impl(data, length, crc);
+    }
+}
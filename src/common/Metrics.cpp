@@ -0,0 +1,89 @@
+#include "mydb/common/Metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mydb {
+
+    uint64_t ShardedCounter::Load() const {
+        uint64_t total = 0;
+        for (const auto& shard : shards_) {
+            total += shard.value_.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    LatencyHistogram::LatencyHistogram() : shards_(new Shard[METRICS_SHARDS]) {}
+
+    LatencyHistogram::~LatencyHistogram() {
+        delete[] shards_;
+    }
+
+    uint64_t LatencyHistogram::BucketUpperBound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        if (index >= NUM_BUCKETS - 1) {
+            return UINT64_MAX;
+        }
+        int exponent = static_cast<int>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+        uint64_t sub = index % SUB_BUCKETS;
+        uint64_t width = 1ULL << (exponent - SUB_BUCKET_BITS);
+        return ((SUB_BUCKETS + sub) << (exponent - SUB_BUCKET_BITS)) + width - 1;
+    }
+
+    HistogramSnapshot LatencyHistogram::Snapshot() const {
+        HistogramSnapshot snapshot;
+        snapshot.buckets.assign(NUM_BUCKETS, 0);
+
+        for (size_t s = 0; s < METRICS_SHARDS; s++) {
+            const Shard& shard = shards_[s];
+            snapshot.sum += shard.sum_.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < NUM_BUCKETS; i++) {
+                uint64_t n = shard.buckets_[i].load(std::memory_order_relaxed);
+                snapshot.buckets[i] += n;
+                snapshot.count += n;
+            }
+        }
+        return snapshot;
+    }
+
+    uint64_t HistogramSnapshot::Percentile(double p) const {
+        if (count == 0) {
+            return 0;
+        }
+
+        // p번째 백분위에 해당하는 순위 (1부터)
+        auto rank = static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * static_cast<double>(count)));
+        rank = std::max<uint64_t>(rank, 1);
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < buckets.size(); i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return LatencyHistogram::BucketUpperBound(i);
+            }
+        }
+        return Max();
+    }
+
+    uint64_t HistogramSnapshot::Max() const {
+        for (size_t i = buckets.size(); i > 0; i--) {
+            if (buckets[i - 1] != 0) {
+                return LatencyHistogram::BucketUpperBound(i - 1);
+            }
+        }
+        return 0;
+    }
+
+    HistogramSnapshot HistogramSnapshot::Since(const HistogramSnapshot& earlier) const {
+        HistogramSnapshot diff;
+        diff.count = count - earlier.count;
+        diff.sum = sum - earlier.sum;
+        diff.buckets = buckets;
+        for (size_t i = 0; i < std::min(buckets.size(), earlier.buckets.size()); i++) {
+            diff.buckets[i] -= earlier.buckets[i];
+        }
+        return diff;
+    }
+}
@@ -0,0 +1,427 @@
+#include "mydb/execution/ExternalSort.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "mydb/buffer/PagePrefetcher.hpp"
+#include "mydb/execution/TempRun.hpp"
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    namespace {
+        constexpr size_t PREFIX_SIZE = sizeof(uint64_t);
+
+        // 자동으로 정한 fan-in의 상한 (loser tree 높이 8)
+        constexpr size_t MAX_AUTO_FAN_IN = 256;
+
+        /**
+         * @brief run 레코드 레이아웃: [정규화된 prefix 8][원래 키 key_length][payload payload_length]
+         * prefix를 부호 없는 정수로 비교한 순서 = 원하는 정렬 순서 (같으면 키 나머지 바이트로 결정)
+         */
+        class RecordFormat {
+        public:
+            explicit RecordFormat(const SortColumns& columns)
+                : columns_(columns),
+                  key_length_(columns.key_type == SortKeyType::INT64 ? sizeof(int64_t) : columns.key_length),
+                  record_size_(PREFIX_SIZE + key_length_ + columns.payload_length),
+                  needs_tie_break_(columns.key_type == SortKeyType::BYTES && key_length_ > PREFIX_SIZE) {
+                if (key_length_ == 0) {
+                    throw std::runtime_error("ExternalSort: key length must be positive");
+                }
+                if (TempPageLayout::RecordsPerPage(record_size_) == 0) {
+                    throw std::runtime_error("ExternalSort: sort record of " + std::to_string(record_size_) +
+                                             " bytes does not fit in a page");
+                }
+            }
+
+            inline size_t get_record_size() const { return record_size_; }
+            inline size_t get_key_length() const { return key_length_; }
+            inline bool needs_tie_break() const { return needs_tie_break_; }
+
+            // 튜플 앞부분이 컬럼을 다 담을 수 있는 최소 길이
+            inline size_t GetMinTupleLength() const {
+                return std::max(columns_.key_offset + key_length_, columns_.payload_offset + columns_.payload_length);
+            }
+
+            // 튜플에서 레코드 하나를 만들고 prefix 반환
+            inline uint64_t Encode(const char* tuple, char* record) const {
+                const char* key = tuple + columns_.key_offset;
+                uint64_t prefix = Prefix(key);
+                std::memcpy(record, &prefix, PREFIX_SIZE);
+                std::memcpy(record + PREFIX_SIZE, key, key_length_);
+                std::memcpy(record + PREFIX_SIZE + key_length_, tuple + columns_.payload_offset, columns_.payload_length);
+                return prefix;
+            }
+
+            // prefix가 같은 두 레코드의 키 나머지(9바이트째부터) 비교
+            inline int CompareTail(const char* a, const char* b) const {
+                int result = std::memcmp(a + 2 * PREFIX_SIZE, b + 2 * PREFIX_SIZE, key_length_ - PREFIX_SIZE);
+                return columns_.descending ? -result : result;
+            }
+
+            static inline uint64_t GetPrefix(const char* record) {
+                uint64_t prefix;
+                std::memcpy(&prefix, record, PREFIX_SIZE);
+                return prefix;
+            }
+
+            inline const char* GetKey(const char* record) const { return record + PREFIX_SIZE; }
+            inline const char* GetPayload(const char* record) const { return record + PREFIX_SIZE + key_length_; }
+
+        private:
+            /**
+             * @brief INT64: 부호 비트를 뒤집으면 부호 없는 비교 순서가 부호 있는 순서와 같아짐
+             * BYTES: 앞 8바이트를 big-endian 정수로 읽으면 정수 비교 = memcmp (짧으면 0으로 채움)
+             * 내림차순은 비트를 모두 뒤집음
+             */
+            inline uint64_t Prefix(const char* key) const {
+                uint64_t prefix;
+                if (columns_.key_type == SortKeyType::INT64) {
+                    int64_t value;
+                    std::memcpy(&value, key, sizeof(value));
+                    prefix = static_cast<uint64_t>(value) ^ (uint64_t{1} << 63);
+                } else {
+                    size_t n = std::min(key_length_, PREFIX_SIZE);
+                    prefix = 0;
+                    for (size_t i = 0; i < n; i++) {
+                        prefix = (prefix << 8) | static_cast<uint8_t>(key[i]);
+                    }
+                    prefix <<= 8 * (PREFIX_SIZE - n);
+                }
+                return columns_.descending ? ~prefix : prefix;
+            }
+
+            SortColumns columns_;
+            size_t key_length_;
+            size_t record_size_;
+            bool needs_tie_break_;
+        };
+
+        // 메모리 안 정렬 항목. 레코드를 옮기지 않고 16바이트 항목만 정렬함
+        struct SortItem {
+            uint64_t prefix;
+            uint64_t offset; // RunBuffer 안 레코드 위치
+        };
+
+        /**
+         * @brief run 하나를 모으는 메모리 버퍼 (레코드 + 정렬 항목이 memory_limit 안에 들어가는 만큼)
+         * 버퍼는 run마다 재사용함
+         */
+        class RunBuffer {
+        public:
+            RunBuffer(const RecordFormat& format, size_t memory_limit)
+                : format_(format),
+                  max_rows_(std::max<size_t>(memory_limit / (format.get_record_size() + sizeof(SortItem)), 1)) {}
+
+            inline bool is_full() const { return items_.size() == max_rows_; }
+            inline bool is_empty() const { return items_.empty(); }
+            inline size_t get_size() const { return items_.size(); }
+
+            inline void Add(const char* tuple) {
+                size_t offset = items_.size() * format_.get_record_size();
+                if (offset + format_.get_record_size() > records_.size()) {
+                    Grow();
+                }
+                uint64_t prefix = format_.Encode(tuple, records_.data() + offset);
+                items_.push_back(SortItem{prefix, offset});
+            }
+
+            void Sort() {
+                if (format_.needs_tie_break()) {
+                    std::sort(items_.begin(), items_.end(), [&](const SortItem& a, const SortItem& b) {
+                        if (a.prefix != b.prefix) {
+                            return a.prefix < b.prefix;
+                        }
+                        return format_.CompareTail(records_.data() + a.offset, records_.data() + b.offset) < 0;
+                    });
+                } else {
+                    std::sort(items_.begin(), items_.end(), [](const SortItem& a, const SortItem& b) {
+                        return a.prefix < b.prefix;
+                    });
+                }
+            }
+
+            // 정렬된 순서로 i번째 레코드
+            inline const char* GetRecord(size_t i) const { return records_.data() + items_[i].offset; }
+
+            // 정렬된 레코드를 임시 페이지에 쓰고 비움
+            TempRun Spill(BufferPoolManager* bpm) {
+                TempRunWriter writer(bpm, format_.get_record_size());
+                for (const auto& item : items_) {
+                    writer.Append(records_.data() + item.offset);
+                }
+                items_.clear();
+                return writer.Finish();
+            }
+
+        private:
+            void Grow() {
+                size_t record_size = format_.get_record_size();
+                size_t rows = std::min(std::max<size_t>(records_.size() / record_size * 2, 1024), max_rows_);
+                records_.resize(rows * record_size);
+            }
+
+            const RecordFormat& format_;
+            size_t max_rows_;
+            std::vector<char> records_;
+            std::vector<SortItem> items_;
+        };
+
+        // 병합 입력 하나: 임시 페이지의 run, 또는 메모리에 남긴 마지막 run
+        class MergeSource {
+        public:
+            MergeSource(BufferPoolManager* bpm, TempRun run, size_t record_size, PagePrefetcher* prefetcher)
+                : reader_(std::make_unique<TempRunReader>(bpm, std::move(run), record_size, prefetcher)) {}
+
+            explicit MergeSource(const RunBuffer* buffer) : buffer_(buffer) {}
+
+            // 다음 레코드 (끝이면 nullptr). 포인터는 다음 Next 호출 전까지만 유효
+            inline const char* Next() {
+                if (reader_) {
+                    return reader_->Next();
+                }
+                return index_ < buffer_->get_size() ? buffer_->GetRecord(index_++) : nullptr;
+            }
+
+        private:
+            std::unique_ptr<TempRunReader> reader_;
+            const RunBuffer* buffer_ = nullptr;
+            size_t index_ = 0;
+        };
+
+        /**
+         * @brief k-way 병합용 loser tree
+         * 내부 노드 tree_[1..k-1]에 그 노드 경기의 패자를, tree_[0]에 전체 승자를 둠 (리프 i = 노드 k + i).
+         * 승자를 내보낸 뒤에는 그 리프에서 루트까지의 경로만 다시 겨루므로 레코드마다 비교가 log2(k)번
+         */
+        class LoserTree {
+        public:
+            LoserTree(const RecordFormat& format, std::vector<MergeSource>* sources)
+                : format_(format), sources_(*sources), heads_(sources->size()), tree_(sources->size()) {}
+
+            template <typename Fn>
+            void Merge(Fn fn) {
+                const size_t k = sources_.size();
+                if (k == 0) {
+                    return;
+                }
+                for (size_t i = 0; i < k; i++) {
+                    Advance(i);
+                }
+                Build();
+                while (true) {
+                    size_t winner = tree_[0];
+                    if (heads_[winner].record == nullptr) {
+                        break;
+                    }
+                    fn(heads_[winner].record);
+                    Advance(winner);
+                    Replay(winner);
+                }
+            }
+
+        private:
+            struct Head {
+                uint64_t prefix;
+                const char* record; // nullptr이면 끝난 입력 (누구보다도 큼)
+            };
+
+            inline void Advance(size_t i) {
+                const char* record = sources_[i].Next();
+                heads_[i].record = record;
+                if (record != nullptr) {
+                    heads_[i].prefix = RecordFormat::GetPrefix(record);
+                }
+            }
+
+            // a가 b보다 먼저 나가야 하면 true (키가 같으면 입력 번호가 작은 쪽)
+            inline bool Less(size_t a, size_t b) const {
+                const Head& x = heads_[a];
+                const Head& y = heads_[b];
+                if (x.record == nullptr || y.record == nullptr) {
+                    return y.record == nullptr && x.record != nullptr;
+                }
+                if (x.prefix != y.prefix) {
+                    return x.prefix < y.prefix;
+                }
+                if (format_.needs_tie_break()) {
+                    int result = format_.CompareTail(x.record, y.record);
+                    if (result != 0) {
+                        return result < 0;
+                    }
+                }
+                return a < b;
+            }
+
+            // 리프부터 올라가며 모든 내부 노드의 경기를 치름
+            void Build() {
+                const size_t k = sources_.size();
+                std::vector<size_t> winners(2 * k);
+                for (size_t i = 0; i < k; i++) {
+                    winners[k + i] = i;
+                }
+                for (size_t node = k - 1; node > 0; node--) {
+                    size_t left = winners[2 * node];
+                    size_t right = winners[2 * node + 1];
+                    bool right_wins = Less(right, left);
+                    winners[node] = right_wins ? right : left;
+                    tree_[node] = right_wins ? left : right;
+                }
+                tree_[0] = k == 1 ? 0 : winners[1];
+            }
+
+            // 리프 leaf의 새 값으로 루트까지 경로의 경기를 다시 치름
+            inline void Replay(size_t leaf) {
+                size_t winner = leaf;
+                for (size_t node = (leaf + sources_.size()) / 2; node > 0; node /= 2) {
+                    if (Less(tree_[node], winner)) {
+                        std::swap(tree_[node], winner);
+                    }
+                }
+                tree_[0] = winner;
+            }
+
+            const RecordFormat& format_;
+            std::vector<MergeSource>& sources_;
+            std::vector<Head> heads_;
+            std::vector<size_t> tree_;
+        };
+
+        // run들(+ 메모리 run)을 병합해서 레코드를 순서대로 fn에 넘김. 읽은 run의 페이지는 반납됨
+        template <typename Fn>
+        void MergeRuns(BufferPoolManager* bpm, const RecordFormat& format, std::vector<TempRun> runs,
+                       const RunBuffer* memory_run, PagePrefetcher* prefetcher, Fn fn) {
+            std::vector<MergeSource> sources;
+            sources.reserve(runs.size() + 1);
+            for (auto& run : runs) {
+                sources.emplace_back(bpm, std::move(run), format.get_record_size(), prefetcher);
+            }
+            if (memory_run != nullptr && !memory_run->is_empty()) {
+                sources.emplace_back(memory_run);
+            }
+            LoserTree tree(format, &sources);
+            tree.Merge(fn);
+        }
+
+        // 병합을 기다리는 run 목록. 도중에 예외가 나도 임시 페이지를 반납
+        struct PendingRuns {
+            BufferPoolManager* bpm;
+            std::vector<TempRun> runs;
+
+            ~PendingRuns() {
+                for (auto& run : runs) {
+                    FreeTempRun(bpm, &run);
+                }
+            }
+        };
+    }
+
+    ExternalSort::ExternalSort(BufferPoolManager* bpm, const ExternalSortOptions& options)
+        : bpm_(bpm), options_(options) {}
+
+    ExternalSortStats ExternalSort::Execute(const std::vector<PageId>& pages, const SortColumns& columns,
+                                            const Emit& emit) {
+        auto start = std::chrono::steady_clock::now();
+        ExternalSortStats stats;
+        RecordFormat format(columns);
+
+        // 1. run 생성
+        RunBuffer buffer(format, options_.memory_limit);
+        PendingRuns pending{bpm_, {}};
+        auto spill = [&] {
+            buffer.Sort();
+            pending.runs.push_back(buffer.Spill(bpm_));
+            stats.spilled_pages += pending.runs.back().pages.size();
+        };
+
+        size_t min_length = format.GetMinTupleLength();
+        for (PageId page_id : pages) {
+            auto* page = reinterpret_cast<const TablePage*>(bpm_->FetchPage(page_id));
+            if (page == nullptr) {
+                throw std::runtime_error("ExternalSort: failed to fetch page " + std::to_string(page_id));
+            }
+            try {
+                const Slot* slots = page->GetSlotArray();
+                uint16_t num_slots = page->GetHeader()->num_slots_;
+                for (uint16_t i = 0; i < num_slots; i++) {
+                    if (slots[i].length_ == 0) {
+                        continue; // 삭제된 튜플
+                    }
+                    if (slots[i].length_ < min_length) {
+                        throw std::runtime_error("ExternalSort: tuple too short for sort columns on page " +
+                                                 std::to_string(page_id));
+                    }
+                    // 다 찬 run은 다음 행이 올 때 내보냄 (마지막 run은 메모리에 남김)
+                    if (buffer.is_full()) {
+                        spill();
+                    }
+                    buffer.Add(page->get_data() + slots[i].offset_);
+                    stats.input_rows++;
+                }
+            } catch (...) {
+                bpm_->UnpinPage(page_id, false);
+                throw;
+            }
+            bpm_->UnpinPage(page_id, false);
+        }
+        buffer.Sort();
+        stats.runs = pending.runs.size() + (buffer.is_empty() ? 0 : 1);
+
+        auto emit_record = [&](const char* record) {
+            emit(format.GetKey(record), format.GetPayload(record));
+        };
+
+        // 전부 메모리에 들어갔으면 병합 없이 끝
+        if (pending.runs.empty()) {
+            for (size_t i = 0; i < buffer.get_size(); i++) {
+                emit_record(buffer.GetRecord(i));
+            }
+            stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            return stats;
+        }
+
+        // 2. 병합. 읽는 run마다 1페이지(프리페치면 2페이지)를 pin하므로 풀의 절반 안에서 fan-in을 정함
+        size_t pins_per_run = options_.prefetch ? 2 : 1;
+        size_t max_fan_in = (bpm_->get_pool_size() - 1) / pins_per_run;
+        size_t fan_in = options_.max_fan_in != 0 ? std::min(options_.max_fan_in, max_fan_in)
+                                                 : std::min(bpm_->get_pool_size() / (2 * pins_per_run), MAX_AUTO_FAN_IN);
+        fan_in = std::max<size_t>(fan_in, 2);
+
+        std::unique_ptr<PagePrefetcher> prefetcher;
+        if (options_.prefetch) {
+            prefetcher = std::make_unique<PagePrefetcher>(bpm_);
+        }
+
+        // 중간 병합: 작은 run부터 묶어서, 남은 run 수가 정확히 fan_in이 되도록 첫 병합의 크기를 맞춤
+        while (pending.runs.size() > fan_in) {
+            std::stable_sort(pending.runs.begin(), pending.runs.end(), [](const TempRun& a, const TempRun& b) {
+                return a.num_records < b.num_records;
+            });
+            size_t k = std::min(fan_in, pending.runs.size() - fan_in + 1);
+            std::vector<TempRun> inputs(std::make_move_iterator(pending.runs.begin()),
+                                        std::make_move_iterator(pending.runs.begin() + static_cast<ptrdiff_t>(k)));
+            pending.runs.erase(pending.runs.begin(), pending.runs.begin() + static_cast<ptrdiff_t>(k));
+
+            TempRunWriter writer(bpm_, format.get_record_size());
+            MergeRuns(bpm_, format, std::move(inputs), nullptr, prefetcher.get(), [&](const char* record) {
+                writer.Append(record);
+            });
+            pending.runs.push_back(writer.Finish());
+            stats.spilled_pages += pending.runs.back().pages.size();
+            stats.merge_passes++;
+        }
+
+        MergeRuns(bpm_, format, std::move(pending.runs), &buffer, prefetcher.get(), emit_record);
+        pending.runs.clear();
+
+        if (prefetcher) {
+            stats.prefetch_waits = prefetcher->get_num_waits();
+        }
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return stats;
+    }
+}
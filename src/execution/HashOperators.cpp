@@ -0,0 +1,280 @@
+#include "mydb/execution/HashOperators.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "mydb/execution/RadixPartitioner.hpp"
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    namespace {
+        // 입력 entry 수 추정 (16바이트 튜플로 꽉 찬 페이지 기준 상한)
+        size_t EstimateEntries(const std::vector<PageId>& pages) {
+            return pages.size() * (PAGE_TRAILER_OFFSET / (sizeof(HashEntry) + sizeof(Slot)));
+        }
+
+        int ChooseBits(const HashOperatorOptions& options, size_t num_entries, size_t slot_bytes) {
+            if (options.radix_bits >= 0) {
+                return options.radix_bits;
+            }
+            return RadixPartitioner::ChooseRadixBits(num_entries, slot_bytes, options.partition_table_bytes);
+        }
+
+        // 페이지를 하나씩 pin해서 살아 있는 튜플마다 (key, value)를 뽑아 fn에 넘김
+        template <typename Fn>
+        void ScanEntries(BufferPoolManager* bpm, const std::vector<PageId>& pages, const KeyValueColumns& columns, Fn fn) {
+            size_t min_length = std::max(columns.key_offset, columns.value_offset) + sizeof(int64_t);
+            for (PageId page_id : pages) {
+                auto* page = reinterpret_cast<const TablePage*>(bpm->FetchPage(page_id));
+                if (page == nullptr) {
+                    throw std::runtime_error("Hash operator: failed to fetch page " + std::to_string(page_id));
+                }
+                try {
+                    const Slot* slots = page->GetSlotArray();
+                    uint16_t num_slots = page->GetHeader()->num_slots_;
+                    for (uint16_t i = 0; i < num_slots; i++) {
+                        if (slots[i].length_ == 0) {
+                            continue; // 삭제된 튜플
+                        }
+                        if (slots[i].length_ < min_length) {
+                            throw std::runtime_error("Hash operator: tuple too short for key/value columns on page " +
+                                                     std::to_string(page_id));
+                        }
+                        const char* tuple = page->get_data() + slots[i].offset_;
+                        HashEntry entry;
+                        std::memcpy(&entry.key, tuple + columns.key_offset, sizeof(entry.key));
+                        std::memcpy(&entry.value, tuple + columns.value_offset, sizeof(entry.value));
+                        fn(entry);
+                    }
+                } catch (...) {
+                    bpm->UnpinPage(page_id, false);
+                    throw;
+                }
+                bpm->UnpinPage(page_id, false);
+            }
+        }
+
+        /**
+         * @brief 집계용 flat 테이블 (linear probing, 부하율 1/2을 넘으면 두 배로)
+         * 그룹 수를 미리 모르므로 작게 시작해서 늘림. 버킷의 hash == 0이면 빈 버킷.
+         * max_groups에 도달하면 새 그룹은 받지 않음 (이미 있는 그룹은 계속 갱신)
+         */
+        class AggregateTable {
+        public:
+            struct Bucket {
+                uint64_t hash;
+                AggregateRow row;
+            };
+
+            void Reset(size_t max_groups = SIZE_MAX) {
+                buckets_.assign(INITIAL_CAPACITY, Bucket{});
+                mask_ = INITIAL_CAPACITY - 1;
+                size_ = 0;
+                max_groups_ = max_groups;
+            }
+
+            // entry.key 그룹이 없고 더 만들 수도 없으면 false
+            inline bool Add(uint64_t hash, const HashEntry& entry) {
+                size_t index = hash & mask_;
+                while (true) {
+                    Bucket& bucket = buckets_[index];
+                    if (bucket.hash == hash && bucket.row.key == entry.key) {
+                        bucket.row.count++;
+                        bucket.row.sum += entry.value;
+                        bucket.row.min = std::min(bucket.row.min, entry.value);
+                        bucket.row.max = std::max(bucket.row.max, entry.value);
+                        return true;
+                    }
+                    if (bucket.hash == 0) {
+                        if (size_ >= max_groups_) {
+                            return false;
+                        }
+                        bucket.hash = hash;
+                        bucket.row = AggregateRow{entry.key, 1, entry.value, entry.value, entry.value};
+                        if (++size_ * 2 > buckets_.size()) {
+                            Grow();
+                        }
+                        return true;
+                    }
+                    index = (index + 1) & mask_;
+                }
+            }
+
+            template <typename Fn>
+            void ForEach(Fn fn) const {
+                for (const auto& bucket : buckets_) {
+                    if (bucket.hash != 0) {
+                        fn(bucket.row);
+                    }
+                }
+            }
+
+            inline size_t get_size() const { return size_; }
+
+        private:
+            static constexpr size_t INITIAL_CAPACITY = 1024;
+
+            void Grow() {
+                std::vector<Bucket> old(buckets_.size() * 2, Bucket{});
+                old.swap(buckets_);
+                mask_ = buckets_.size() - 1;
+                for (const auto& bucket : old) {
+                    if (bucket.hash == 0) {
+                        continue;
+                    }
+                    size_t index = bucket.hash & mask_;
+                    while (buckets_[index].hash != 0) {
+                        index = (index + 1) & mask_;
+                    }
+                    buckets_[index] = bucket;
+                }
+            }
+
+            std::vector<Bucket> buckets_;
+            size_t mask_ = 0;
+            size_t size_ = 0;
+            size_t max_groups_ = SIZE_MAX;
+        };
+
+        /**
+         * @brief 조인 build용 flat 테이블. 크기를 알고 만드므로 늘리지 않음 (부하율 1/2 이하)
+         * 중복 키도 빈 버킷에 그냥 넣고, probe는 빈 버킷을 만날 때까지 해시 + 키가 같은 버킷을 모두 내보냄
+         */
+        class JoinTable {
+        public:
+            struct Bucket {
+                uint64_t hash;
+                int64_t key;
+                int64_t value;
+            };
+
+            void Build(const std::vector<HashEntry>& entries) {
+                size_t capacity = std::bit_ceil(std::max<size_t>(entries.size() * 2, 16));
+                buckets_.assign(capacity, Bucket{});
+                mask_ = capacity - 1;
+                for (const auto& entry : entries) {
+                    uint64_t hash = HashKey(entry.key);
+                    size_t index = hash & mask_;
+                    while (buckets_[index].hash != 0) {
+                        index = (index + 1) & mask_;
+                    }
+                    buckets_[index] = Bucket{hash, entry.key, entry.value};
+                }
+            }
+
+            template <typename Fn>
+            inline size_t Probe(const HashEntry& entry, Fn fn) const {
+                uint64_t hash = HashKey(entry.key);
+                size_t matches = 0;
+                for (size_t index = hash & mask_; buckets_[index].hash != 0; index = (index + 1) & mask_) {
+                    const Bucket& bucket = buckets_[index];
+                    if (bucket.hash == hash && bucket.key == entry.key) {
+                        fn(bucket.value);
+                        matches++;
+                    }
+                }
+                return matches;
+            }
+
+        private:
+            std::vector<Bucket> buckets_;
+            size_t mask_ = 0;
+        };
+    }
+
+    HashAggregate::HashAggregate(BufferPoolManager* bpm, const HashOperatorOptions& options)
+        : bpm_(bpm), options_(options) {}
+
+    HashOperatorStats HashAggregate::Execute(const std::vector<PageId>& pages, const KeyValueColumns& columns,
+                                             const Emit& emit) {
+        auto start = std::chrono::steady_clock::now();
+        HashOperatorStats stats;
+
+        int radix_bits = ChooseBits(options_, EstimateEntries(pages), sizeof(AggregateTable::Bucket));
+        RadixPartitioner partitioner(bpm_, radix_bits, options_.memory_limit);
+
+        // 사전 집계: 캐시에 들어가는 테이블에 먼저 받은 그룹들은 끝까지 여기서 집계하고, 나머지 키의 행만 파티셔닝.
+        // 한 번 들어간 키는 빠지지 않으므로 두 쪽의 그룹이 겹치지 않음 (그룹이 적으면 파티셔닝 없이 끝남)
+        AggregateTable table;
+        table.Reset(options_.partition_table_bytes / sizeof(AggregateTable::Bucket) / 2);
+        ScanEntries(bpm_, pages, columns, [&](const HashEntry& entry) {
+            uint64_t hash = HashKey(entry.key);
+            if (!table.Add(hash, entry)) {
+                partitioner.Add(hash, entry);
+            }
+            stats.input_rows++;
+        });
+        table.ForEach(emit);
+        stats.output_rows += table.get_size();
+
+        std::vector<HashEntry> entries;
+        for (size_t p = 0; p < partitioner.get_num_partitions(); p++) {
+            if (partitioner.GetPartitionSize(p) == 0) {
+                continue;
+            }
+            partitioner.TakePartition(p, &entries);
+            table.Reset();
+            for (const auto& entry : entries) {
+                table.Add(HashKey(entry.key), entry);
+            }
+            table.ForEach(emit);
+            stats.output_rows += table.get_size();
+        }
+
+        stats.partitions = partitioner.get_num_partitions();
+        stats.spilled_pages = partitioner.get_spilled_pages();
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return stats;
+    }
+
+    HashJoin::HashJoin(BufferPoolManager* bpm, const HashOperatorOptions& options)
+        : bpm_(bpm), options_(options) {}
+
+    HashOperatorStats HashJoin::Execute(const std::vector<PageId>& build_pages, const KeyValueColumns& build_columns,
+                                        const std::vector<PageId>& probe_pages, const KeyValueColumns& probe_columns,
+                                        const Emit& emit) {
+        auto start = std::chrono::steady_clock::now();
+        HashOperatorStats stats;
+
+        int radix_bits = ChooseBits(options_, EstimateEntries(build_pages), sizeof(JoinTable::Bucket));
+        RadixPartitioner build(bpm_, radix_bits, options_.memory_limit / 2);
+        RadixPartitioner probe(bpm_, radix_bits, options_.memory_limit / 2);
+        ScanEntries(bpm_, build_pages, build_columns, [&](const HashEntry& entry) {
+            build.Add(HashKey(entry.key), entry);
+            stats.input_rows++;
+        });
+        ScanEntries(bpm_, probe_pages, probe_columns, [&](const HashEntry& entry) {
+            probe.Add(HashKey(entry.key), entry);
+            stats.input_rows++;
+        });
+
+        JoinTable table;
+        std::vector<HashEntry> build_entries;
+        std::vector<HashEntry> probe_entries;
+        for (size_t p = 0; p < build.get_num_partitions(); p++) {
+            // 한쪽이 비면 결과가 없으므로 다른 쪽은 읽지 않고 버림
+            if (build.GetPartitionSize(p) == 0 || probe.GetPartitionSize(p) == 0) {
+                build.DropPartition(p);
+                probe.DropPartition(p);
+                continue;
+            }
+            build.TakePartition(p, &build_entries);
+            table.Build(build_entries);
+            probe.TakePartition(p, &probe_entries);
+            for (const auto& entry : probe_entries) {
+                stats.output_rows += table.Probe(entry, [&](int64_t build_value) {
+                    emit(entry.key, build_value, entry.value);
+                });
+            }
+        }
+
+        stats.partitions = build.get_num_partitions();
+        stats.spilled_pages = build.get_spilled_pages() + probe.get_spilled_pages();
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return stats;
+    }
+}
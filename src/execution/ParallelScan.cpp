@@ -0,0 +1,181 @@
+#include "mydb/execution/ParallelScan.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace mydb {
+
+    namespace {
+        /**
+         * @brief 워커 하나의 morsel deque
+         * 처음에 연속된 morsel 번호 구간 [front, back)을 받고 이후 새로 들어오는 일은 없으므로,
+         * deque 전체를 64비트 하나(앞 32비트 front, 뒤 32비트 back)로 표현하고 CAS로 양쪽 끝을 줄임 (락 없음)
+         */
+        struct alignas(CACHE_LINE_SIZE) MorselDeque {
+            std::atomic<uint64_t> range_{0};
+        };
+
+        inline uint64_t PackRange(uint32_t front, uint32_t back) {
+            return (static_cast<uint64_t>(front) << 32) | back;
+        }
+
+        // 주인 워커: 앞에서 하나 (페이지 순서대로 읽게)
+        bool PopFront(MorselDeque& deque, uint32_t* morsel) {
+            uint64_t range = deque.range_.load(std::memory_order_acquire);
+            while (true) {
+                auto front = static_cast<uint32_t>(range >> 32);
+                auto back = static_cast<uint32_t>(range);
+                if (front >= back) {
+                    return false;
+                }
+                if (deque.range_.compare_exchange_weak(range, PackRange(front + 1, back), std::memory_order_acq_rel)) {
+                    *morsel = front;
+                    return true;
+                }
+            }
+        }
+
+        // 다른 워커: 뒤에서 남은 것의 절반 (한 번 훔친 뒤 한동안 다시 훔칠 필요가 없게)
+        bool StealHalf(MorselDeque& deque, uint32_t* first, uint32_t* last) {
+            uint64_t range = deque.range_.load(std::memory_order_acquire);
+            while (true) {
+                auto front = static_cast<uint32_t>(range >> 32);
+                auto back = static_cast<uint32_t>(range);
+                if (front >= back) {
+                    return false;
+                }
+                uint32_t take = (back - front + 1) / 2;
+                if (deque.range_.compare_exchange_weak(range, PackRange(front, back - take), std::memory_order_acq_rel)) {
+                    *first = back - take;
+                    *last = back;
+                    return true;
+                }
+            }
+        }
+    }
+
+    ParallelScan::ParallelScan(BufferPoolManager* bpm, std::vector<PageId> pages, const ParallelScanOptions& options)
+        : bpm_(bpm), pages_(std::move(pages)), morsel_pages_(std::max<PageId>(options.morsel_pages, 1)) {
+        num_threads_ = options.num_threads != 0 ? options.num_threads
+                                                : std::max(1u, std::thread::hardware_concurrency());
+        if ((pages_.size() + morsel_pages_ - 1) / morsel_pages_ > UINT32_MAX) {
+            throw std::runtime_error("ParallelScan: too many morsels, increase morsel_pages");
+        }
+    }
+
+    std::vector<PageId> ParallelScan::CollectPages(BufferPoolManager* bpm, PageId first_page_id) {
+        std::vector<PageId> pages;
+        PageId page_id = first_page_id;
+        while (page_id != INVALID_PAGE_ID) {
+            Page* page = bpm->FetchPage(page_id);
+            if (page == nullptr) {
+                throw std::runtime_error("ParallelScan: failed to fetch page " + std::to_string(page_id));
+            }
+            pages.push_back(page_id);
+            PageId next_page_id = reinterpret_cast<TablePage*>(page)->GetHeader()->next_page_id_;
+            bpm->UnpinPage(page_id, false);
+            page_id = next_page_id;
+        }
+        return pages;
+    }
+
+    ParallelScanStats ParallelScan::Run(const PageVisitor& visitor) {
+        auto start = std::chrono::steady_clock::now();
+
+        // morsel 번호 구간을 워커 수로 나눠서 미리 분배 (워커마다 연속 구간)
+        auto num_morsels = static_cast<uint32_t>((pages_.size() + morsel_pages_ - 1) / morsel_pages_);
+        std::vector<MorselDeque> deques(num_threads_);
+        for (size_t w = 0; w < num_threads_; w++) {
+            auto front = static_cast<uint32_t>(num_morsels * w / num_threads_);
+            auto back = static_cast<uint32_t>(num_morsels * (w + 1) / num_threads_);
+            deques[w].range_.store(PackRange(front, back), std::memory_order_relaxed);
+        }
+
+        std::atomic<size_t> pages_scanned{0};
+        std::atomic<size_t> stolen_morsels{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        auto scan_morsel = [&](size_t worker, uint32_t morsel) {
+            size_t first = static_cast<size_t>(morsel) * morsel_pages_;
+            size_t last = std::min(first + morsel_pages_, pages_.size());
+            for (size_t i = first; i < last; i++) {
+                PageId page_id = pages_[i];
+                Page* page = bpm_->FetchPage(page_id);
+                if (page == nullptr) {
+                    throw std::runtime_error("ParallelScan: no free frame for page " + std::to_string(page_id));
+                }
+                try {
+                    visitor(worker, reinterpret_cast<const TablePage*>(page));
+                } catch (...) {
+                    bpm_->UnpinPage(page_id, false);
+                    throw;
+                }
+                bpm_->UnpinPage(page_id, false);
+            }
+            pages_scanned.fetch_add(last - first, std::memory_order_relaxed);
+        };
+
+        // 자기 deque가 비면 다음 워커부터 돌면서 훔쳐서 자기 deque에 넣음. 모두 비었으면 false
+        // (훔친 구간은 잠깐 어느 deque에도 없지만, 훔친 워커가 처리하므로 다른 워커가 먼저 끝나도 빠지는 일은 없음)
+        auto steal = [&](size_t worker) {
+            for (size_t i = 1; i < num_threads_; i++) {
+                uint32_t first;
+                uint32_t last;
+                if (StealHalf(deques[(worker + i) % num_threads_], &first, &last)) {
+                    // 자기 deque는 비어 있으므로 다른 워커가 건드리지 않음
+                    deques[worker].range_.store(PackRange(first, last), std::memory_order_release);
+                    stolen_morsels.fetch_add(last - first, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        auto worker_main = [&](size_t worker) {
+            try {
+                uint32_t morsel;
+                while (!failed.load(std::memory_order_relaxed)) {
+                    if (PopFront(deques[worker], &morsel)) {
+                        scan_morsel(worker, morsel);
+                    } else if (!steal(worker)) {
+                        break;
+                    }
+                }
+            } catch (...) {
+                std::scoped_lock lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads_ - 1);
+        for (size_t w = 1; w < num_threads_; w++) {
+            threads.emplace_back(worker_main, w);
+        }
+        worker_main(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        ParallelScanStats stats;
+        stats.pages_scanned = pages_scanned.load(std::memory_order_relaxed);
+        stats.morsels = num_morsels;
+        stats.stolen_morsels = stolen_morsels.load(std::memory_order_relaxed);
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return stats;
+    }
+}
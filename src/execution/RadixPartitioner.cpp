@@ -0,0 +1,90 @@
+#include "mydb/execution/RadixPartitioner.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace mydb {
+
+    RadixPartitioner::RadixPartitioner(BufferPoolManager* bpm, int radix_bits, size_t memory_limit)
+        : bpm_(bpm), max_buffered_(std::max<size_t>(memory_limit / sizeof(HashEntry), 1)) {
+        if (radix_bits < 0 || radix_bits > MAX_RADIX_BITS) {
+            throw std::runtime_error("RadixPartitioner: radix bits must be in [0, " +
+                                     std::to_string(MAX_RADIX_BITS) + "], got " + std::to_string(radix_bits));
+        }
+        partitions_.resize(size_t{1} << radix_bits);
+        mask_ = partitions_.size() - 1;
+    }
+
+    RadixPartitioner::~RadixPartitioner() {
+        for (auto& partition : partitions_) {
+            for (auto& run : partition.runs_) {
+                FreeTempRun(bpm_, &run);
+            }
+        }
+    }
+
+    size_t RadixPartitioner::GetPartitionSize(size_t p) const {
+        return partitions_[p].spilled_entries_ + partitions_[p].buffer_.size();
+    }
+
+    void RadixPartitioner::TakePartition(size_t p, std::vector<HashEntry>* out) {
+        Partition& partition = partitions_[p];
+        out->clear();
+        out->reserve(GetPartitionSize(p));
+
+        for (auto& run : partition.runs_) {
+            TempRunReader reader(bpm_, std::move(run), sizeof(HashEntry));
+            const char* records;
+            while (size_t n = reader.NextBatch(&records)) {
+                size_t old_size = out->size();
+                out->resize(old_size + n);
+                std::memcpy(out->data() + old_size, records, n * sizeof(HashEntry));
+            }
+        }
+        partition.runs_.clear();
+        partition.spilled_entries_ = 0;
+
+        out->insert(out->end(), partition.buffer_.begin(), partition.buffer_.end());
+        buffered_ -= partition.buffer_.size();
+        std::vector<HashEntry>().swap(partition.buffer_);
+    }
+
+    void RadixPartitioner::DropPartition(size_t p) {
+        Partition& partition = partitions_[p];
+        for (auto& run : partition.runs_) {
+            FreeTempRun(bpm_, &run);
+        }
+        partition.runs_.clear();
+        partition.spilled_entries_ = 0;
+        buffered_ -= partition.buffer_.size();
+        std::vector<HashEntry>().swap(partition.buffer_);
+    }
+
+    void RadixPartitioner::SpillLargest() {
+        auto largest = std::max_element(partitions_.begin(), partitions_.end(), [](const auto& a, const auto& b) {
+            return a.buffer_.size() < b.buffer_.size();
+        });
+
+        TempRunWriter writer(bpm_, sizeof(HashEntry));
+        writer.AppendBatch(largest->buffer_.data(), largest->buffer_.size());
+        TempRun run = writer.Finish();
+
+        spilled_pages_ += run.pages.size();
+        largest->spilled_entries_ += run.num_records;
+        largest->runs_.push_back(std::move(run));
+
+        // 용량까지 돌려줘야 memory_limit이 지켜짐
+        buffered_ -= largest->buffer_.size();
+        std::vector<HashEntry>().swap(largest->buffer_);
+    }
+
+    int RadixPartitioner::ChooseRadixBits(size_t num_entries, size_t slot_bytes, size_t target_bytes) {
+        size_t table_bytes = num_entries * 2 * slot_bytes;
+        int bits = 0;
+        while (bits < MAX_RADIX_BITS && (table_bytes >> bits) > target_bytes) {
+            bits++;
+        }
+        return bits;
+    }
+}
@@ -0,0 +1,140 @@
+#include "mydb/execution/TempRun.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mydb {
+
+    TempRunWriter::TempRunWriter(BufferPoolManager* bpm, size_t record_size)
+        : bpm_(bpm), record_size_(record_size), records_per_page_(TempPageLayout::RecordsPerPage(record_size)) {
+        if (record_size_ == 0 || records_per_page_ == 0) {
+            throw std::runtime_error("TempRunWriter: invalid record size " + std::to_string(record_size));
+        }
+    }
+
+    TempRunWriter::~TempRunWriter() {
+        if (!finished_) {
+            SealPage();
+            FreeTempRun(bpm_, &run_);
+        }
+    }
+
+    void TempRunWriter::AppendBatch(const void* records, size_t count) {
+        const char* src = static_cast<const char*>(records);
+        while (count > 0) {
+            if (count_ == records_per_page_ || page_ == nullptr) {
+                NextPage();
+            }
+            size_t n = std::min(count, records_per_page_ - count_);
+            std::memcpy(page_->get_data() + TempPageLayout::HEADER_SIZE + count_ * record_size_, src, n * record_size_);
+            count_ += n;
+            run_.num_records += n;
+            src += n * record_size_;
+            count -= n;
+        }
+    }
+
+    TempRun TempRunWriter::Finish() {
+        SealPage();
+        finished_ = true;
+        return std::move(run_);
+    }
+
+    void TempRunWriter::SealPage() {
+        if (page_ == nullptr) {
+            return;
+        }
+        uint64_t count = count_;
+        std::memcpy(page_->get_data(), &count, sizeof(count));
+        bpm_->UnpinPage(page_id_, true);
+        page_ = nullptr;
+    }
+
+    void TempRunWriter::NextPage() {
+        SealPage();
+        PageId page_id;
+        Page* page = bpm_->NewTempPage(&page_id);
+        if (page == nullptr) {
+            throw std::runtime_error("TempRunWriter: no free frame for a temporary page");
+        }
+        page_ = page;
+        page_id_ = page_id;
+        count_ = 0;
+        run_.pages.push_back(page_id);
+    }
+
+    TempRunReader::TempRunReader(BufferPoolManager* bpm, TempRun run, size_t record_size, PagePrefetcher* prefetcher)
+        : bpm_(bpm), run_(std::move(run)), record_size_(record_size), prefetcher_(prefetcher) {}
+
+    TempRunReader::~TempRunReader() {
+        ReleasePage();
+        if (pending_) {
+            prefetcher_->Cancel(pending_); // pin이 풀려야 DeleteTempPage가 성공함
+        }
+        for (; next_page_ < run_.pages.size(); next_page_++) {
+            bpm_->DeleteTempPage(run_.pages[next_page_]);
+        }
+    }
+
+    size_t TempRunReader::NextBatch(const char** records) {
+        if (index_ == count_ && !NextPage()) {
+            return 0;
+        }
+        *records = records_ + index_ * record_size_;
+        size_t n = count_ - index_;
+        index_ = count_;
+        return n;
+    }
+
+    bool TempRunReader::NextPage() {
+        ReleasePage();
+        while (next_page_ < run_.pages.size()) {
+            PageId page_id = run_.pages[next_page_++];
+            Page* page;
+            if (pending_) {
+                page = prefetcher_->Take(std::exchange(pending_, nullptr));
+            } else {
+                page = bpm_->FetchPage(page_id);
+            }
+            if (page == nullptr) {
+                throw std::runtime_error("TempRunReader: failed to fetch temporary page " + std::to_string(page_id));
+            }
+            if (prefetcher_ != nullptr && next_page_ < run_.pages.size()) {
+                pending_ = prefetcher_->Request(run_.pages[next_page_]);
+            }
+            uint64_t count;
+            std::memcpy(&count, page->get_data(), sizeof(count));
+            page_id_ = page_id;
+            records_ = page->get_data() + TempPageLayout::HEADER_SIZE;
+            count_ = static_cast<size_t>(count);
+            index_ = 0;
+            if (count_ > 0) {
+                return true;
+            }
+            ReleasePage();
+        }
+        return false;
+    }
+
+    void TempRunReader::ReleasePage() {
+        if (page_id_ == INVALID_PAGE_ID) {
+            return;
+        }
+        bpm_->UnpinPage(page_id_, false);
+        bpm_->DeleteTempPage(page_id_);
+        page_id_ = INVALID_PAGE_ID;
+        records_ = nullptr;
+        count_ = 0;
+        index_ = 0;
+    }
+
+    void FreeTempRun(BufferPoolManager* bpm, TempRun* run) {
+        for (PageId page_id : run->pages) {
+            bpm->DeleteTempPage(page_id);
+        }
+        run->pages.clear();
+        run->num_records = 0;
+    }
+}
@@ -0,0 +1,123 @@
+#include "mydb/recovery/Checkpointer.hpp"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace mydb {
+
+    Checkpointer::Checkpointer(BufferPoolManager* bpm, LogManager* log_manager, CheckpointOptions options)
+        : bpm_(bpm), log_manager_(log_manager), options_(options), scratch_(std::make_unique<Page>()) {}
+
+    Checkpointer::~Checkpointer() {
+        Stop();
+    }
+
+    void Checkpointer::Start() {
+        std::scoped_lock lock(mutex_);
+        if (running_) {
+            return;
+        }
+        running_ = true;
+        thread_ = std::thread(&Checkpointer::ThreadMain, this);
+    }
+
+    void Checkpointer::Stop() {
+        {
+            std::scoped_lock lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    CheckpointStats Checkpointer::GetLastStats() {
+        std::scoped_lock lock(mutex_);
+        return last_stats_;
+    }
+
+    void Checkpointer::ThreadMain() {
+        std::unique_lock lock(mutex_);
+
+        while (running_) {
+            if (cv_.wait_for(lock, options_.interval, [&] { return !running_; })) {
+                break;
+            }
+
+            lock.unlock();
+            Checkpoint();
+            lock.lock();
+        }
+    }
+
+    bool Checkpointer::Throttle(std::chrono::steady_clock::time_point start, size_t pages_written) {
+        if (options_.max_pages_per_second == 0) {
+            return true;
+        }
+
+        // pages_written장을 쓰는 데 최소한 걸려야 하는 시간만큼 지났는지
+        auto target = start + std::chrono::microseconds(pages_written * 1'000'000 / options_.max_pages_per_second);
+
+        std::unique_lock lock(mutex_);
+        if (!thread_.joinable()) {
+            // 백그라운드 스레드가 아닌 곳에서 직접 호출한 경우: 그냥 잠
+            lock.unlock();
+            std::this_thread::sleep_until(target);
+            return true;
+        }
+        return !cv_.wait_until(lock, target, [&] { return !running_; });
+    }
+
+    CheckpointStats Checkpointer::Checkpoint() {
+        std::scoped_lock checkpoint_lock(checkpoint_mutex_);
+
+        CheckpointStats stats;
+        auto start = std::chrono::steady_clock::now();
+
+        // 1. dirty 페이지 쓰기 (페이지 ID 순서로 정렬해서 디스크를 가능한 순차적으로 접근)
+        auto dirty_pages = bpm_->GetDirtyPageTable();
+        std::sort(dirty_pages.begin(), dirty_pages.end());
+
+        for (const auto& [page_id, rec_lsn] : dirty_pages) {
+            if (bpm_->WriteBackPage(page_id, scratch_.get())) {
+                stats.pages_written++;
+            }
+            if (!Throttle(start, stats.pages_written)) {
+                break; // 종료 요청: 나머지 페이지는 다음 기회에 (체크포인트 레코드는 그래도 남김)
+            }
+        }
+
+        // 2. 체크포인트 레코드
+        LogRecord begin = LogRecord::MakeTxnRecord(LogRecordType::CHECKPOINT_BEGIN);
+        Lsn begin_lsn = log_manager_->AppendLogRecord(&begin);
+
+        // BEGIN 이후에 스냅샷을 떠야, 복구 시 BEGIN 이후의 로그와 합쳐서 빠짐없는 테이블이 됨
+        auto dirty_page_table = bpm_->GetDirtyPageTable();
+        stats.dirty_pages_recorded = dirty_page_table.size();
+
+        for (size_t i = 0; i < dirty_page_table.size(); i += options_.dpt_entries_per_record) {
+            size_t end = std::min(dirty_page_table.size(), i + options_.dpt_entries_per_record);
+            LogRecord dpt = LogRecord::MakeCheckpointDpt({dirty_page_table.begin() + i, dirty_page_table.begin() + end});
+            log_manager_->AppendLogRecord(&dpt);
+        }
+
+        LogRecord end = LogRecord::MakeCheckpointEnd(log_manager_->GetActiveTxns(), log_manager_->GetNextTxnId());
+        Lsn end_lsn = log_manager_->AppendLogRecord(&end);
+
+        // 3. END까지 영속화된 뒤에 master record(로그 헤더) 갱신
+        log_manager_->Flush(end_lsn);
+        log_manager_->SetCheckpointLsn(begin_lsn);
+
+        stats.checkpoint_lsn = begin_lsn;
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        spdlog::info("Checkpoint at lsn {}: wrote {} pages, {} dirty pages recorded, took {} ms",
+                     begin_lsn, stats.pages_written, stats.dirty_pages_recorded, stats.duration.count() / 1000);
+
+        std::scoped_lock lock(mutex_);
+        last_stats_ = stats;
+        return stats;
+    }
+}
@@ -0,0 +1,217 @@
+#include "mydb/recovery/LogManager.hpp"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace mydb {
+
+    LogManager::LogManager(DiskManager* disk_manager, size_t buffer_size, std::chrono::microseconds flush_interval)
+        : disk_manager_(disk_manager),
+          buffer_size_(buffer_size),
+          flush_interval_(flush_interval),
+          log_buffer_(buffer_size),
+          flush_buffer_(buffer_size) {
+
+        size_t log_size = disk_manager_->GetLogSize();
+
+        if (log_size < LOG_HEADER_SIZE) {
+            // 새 로그 파일: 헤더부터 기록
+            LogFileHeader header;
+            disk_manager_->WriteLog(reinterpret_cast<const char*>(&header), sizeof(header), 0);
+            disk_manager_->SyncLog();
+            log_size = LOG_HEADER_SIZE;
+        } else {
+            LogFileHeader header;
+            disk_manager_->ReadLog(reinterpret_cast<char*>(&header), sizeof(header), 0);
+            if (header.magic_ != LogFileHeader::MAGIC || header.version_ != LogFileHeader::VERSION) {
+                throw std::runtime_error("Invalid log file: " + disk_manager_->get_log_file_name());
+            }
+            checkpoint_lsn_.store(header.checkpoint_lsn_);
+        }
+
+        // 기존 로그가 있으면 그 끝부터 이어서 씀 (깨진 꼬리는 복구 과정에서 잘라냄)
+        buffer_start_lsn_ = log_size;
+        next_lsn_ = log_size;
+        persistent_lsn_.store(log_size, std::memory_order_release);
+
+        flush_thread_ = std::thread(&LogManager::FlushThreadMain, this);
+    }
+
+    LogManager::~LogManager() {
+        {
+            std::scoped_lock lock(latch_);
+            running_ = false;
+        }
+        flush_cv_.notify_one();
+
+        if (flush_thread_.joinable()) {
+            flush_thread_.join();
+        }
+    }
+
+    Lsn LogManager::AppendLogRecord(LogRecord* record, Transaction* txn) {
+        if (record->size_ > buffer_size_) {
+            throw std::runtime_error("AppendLogRecord: log record larger than log buffer");
+        }
+
+        std::unique_lock lock(latch_);
+
+        // 버퍼가 꽉 찼으면 flush 스레드가 버퍼를 교체해줄 때까지 대기
+        while (log_buffer_used_ + record->size_ > buffer_size_) {
+            flush_requested_ = true;
+            flush_cv_.notify_one();
+            append_cv_.wait(lock);
+        }
+
+        Lsn lsn = next_lsn_;
+        record->lsn_ = lsn;
+        if (txn != nullptr) {
+            record->txn_id_ = txn->get_txn_id();
+            record->prev_lsn_ = txn->get_prev_lsn();
+            txn->set_prev_lsn(lsn);
+        }
+
+        record->SerializeTo(log_buffer_.data() + log_buffer_used_);
+        log_buffer_used_ += record->size_;
+        next_lsn_.store(lsn + record->size_, std::memory_order_release);
+
+        // 활성 트랜잭션 테이블 갱신
+        if (txn != nullptr) {
+            if (record->type_ == LogRecordType::COMMIT || record->type_ == LogRecordType::ABORT) {
+                active_txns_.erase(txn->get_txn_id());
+            } else {
+                active_txns_[txn->get_txn_id()] = lsn;
+            }
+        }
+
+        return lsn;
+    }
+
+    void LogManager::Flush(Lsn lsn) {
+        // 이미 영속화된 범위면 바로 리턴 (대부분의 eviction은 여기서 끝남)
+        if (lsn < GetPersistentLsn()) {
+            return;
+        }
+
+        std::unique_lock lock(latch_);
+
+        // 아직 Append되지 않은 LSN을 기다리지 않도록, 현재 로그 끝까지로 제한
+        Lsn target = std::min(lsn + 1, GetNextLsn());
+
+        flush_requested_ = true;
+        flush_cv_.notify_one();
+        persist_cv_.wait(lock, [&] { return GetPersistentLsn() >= target; });
+    }
+
+    void LogManager::FlushAll() {
+        std::unique_lock lock(latch_);
+        Lsn target = GetNextLsn();
+
+        if (GetPersistentLsn() >= target) {
+            return;
+        }
+
+        flush_requested_ = true;
+        flush_cv_.notify_one();
+        persist_cv_.wait(lock, [&] { return GetPersistentLsn() >= target; });
+    }
+
+    Transaction LogManager::Begin() {
+        Transaction txn(next_txn_id_.fetch_add(1));
+
+        LogRecord record = LogRecord::MakeTxnRecord(LogRecordType::BEGIN);
+        AppendLogRecord(&record, &txn);
+
+        return txn;
+    }
+
+    void LogManager::Commit(Transaction* txn) {
+        LogRecord record = LogRecord::MakeTxnRecord(LogRecordType::COMMIT);
+        Lsn lsn = AppendLogRecord(&record, txn);
+
+        // 여기서 기다리는 동안 다른 스레드들의 COMMIT도 같은 배치에 모임
+        Flush(lsn);
+    }
+
+    std::vector<std::pair<TxnId, Lsn>> LogManager::GetActiveTxns() {
+        std::scoped_lock lock(latch_);
+        return {active_txns_.begin(), active_txns_.end()};
+    }
+
+    void LogManager::SetCheckpointLsn(Lsn lsn) {
+        LogFileHeader header;
+        header.checkpoint_lsn_ = lsn;
+
+        // 체크포인트 레코드보다 헤더가 먼저 디스크에 가면 안 되므로, 레코드부터 영속화
+        Flush(lsn);
+        disk_manager_->WriteLog(reinterpret_cast<const char*>(&header), sizeof(header), 0);
+        disk_manager_->SyncLog();
+        checkpoint_lsn_.store(lsn);
+    }
+
+    void LogManager::ResetAfterRecovery(Lsn log_end, TxnId next_txn_id) {
+        std::unique_lock lock(latch_);
+
+        // 복구는 Append 전에 실행되어야 함 (버퍼에 아무것도 없어야 함)
+        persist_cv_.wait(lock, [&] { return log_buffer_used_ == 0 && !flushing_; });
+
+        if (log_end < GetNextLsn()) {
+            spdlog::warn("Truncating torn log tail: {} -> {} bytes", GetNextLsn(), log_end);
+            disk_manager_->TruncateLog(log_end);
+            disk_manager_->SyncLog();
+        }
+
+        buffer_start_lsn_ = log_end;
+        next_lsn_.store(log_end, std::memory_order_release);
+        persistent_lsn_.store(log_end, std::memory_order_release);
+
+        TxnId current = next_txn_id_.load();
+        if (next_txn_id > current) {
+            next_txn_id_.store(next_txn_id);
+        }
+    }
+
+    void LogManager::FlushThreadMain() {
+        std::unique_lock lock(latch_);
+
+        while (true) {
+            // 요청이 오거나, 주기가 지나면 깨어남
+            flush_cv_.wait_for(lock, flush_interval_, [&] { return flush_requested_ || !running_; });
+            flush_requested_ = false;
+
+            if (log_buffer_used_ > 0) {
+                // 버퍼 교체: 이후 Append는 비어있는 버퍼에 계속 쌓임
+                std::swap(log_buffer_, flush_buffer_);
+                size_t flush_size = log_buffer_used_;
+                Lsn flush_start = buffer_start_lsn_;
+
+                log_buffer_used_ = 0;
+                buffer_start_lsn_ = GetNextLsn();
+                flushing_ = true;
+                append_cv_.notify_all();
+
+                // 디스크 I/O 동안은 락을 풀어둠
+                lock.unlock();
+                try {
+                    disk_manager_->WriteLog(flush_buffer_.data(), flush_size, flush_start);
+                    disk_manager_->SyncLog();
+                } catch (const std::exception& e) {
+                    // 로그를 영속화할 수 없으면 커밋을 보장할 방법이 없음
+                    spdlog::critical("Log flush failed: {}", e.what());
+                    std::abort();
+                }
+                lock.lock();
+
+                flushing_ = false;
+                persistent_lsn_.store(flush_start + flush_size, std::memory_order_release);
+                persist_cv_.notify_all();
+            }
+
+            if (!running_ && log_buffer_used_ == 0) {
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,318 @@
+#include "mydb/recovery/LogRecord.hpp"
+
+#include <fmt/format.h>
+#include <cstring>
+
+#include "mydb/common/Crc32c.hpp"
+
+namespace mydb {
+
+    namespace {
+        // 헤더 필드 위치
+        constexpr size_t kSizeOffset = 0;
+        constexpr size_t kChecksumOffset = 4;
+        constexpr size_t kLsnOffset = 8;
+        constexpr size_t kPrevLsnOffset = 16;
+        constexpr size_t kTxnIdOffset = 24;
+        constexpr size_t kTypeOffset = 28;
+
+        template <typename T>
+        void Put(char* buf, size_t* pos, const T& value) {
+            std::memcpy(buf + *pos, &value, sizeof(T));
+            *pos += sizeof(T);
+        }
+
+        template <typename T>
+        T Get(const char* buf, size_t* pos) {
+            T value;
+            std::memcpy(&value, buf + *pos, sizeof(T));
+            *pos += sizeof(T);
+            return value;
+        }
+
+        // checksum 필드(4B)만 빼고 계산
+        uint32_t ComputeRecordChecksum(const char* buf, uint32_t size) {
+            uint32_t crc = Crc32c(buf, kChecksumOffset);
+            return Crc32c(buf + kLsnOffset, size - kLsnOffset, crc);
+        }
+
+        const char* TypeName(LogRecordType type) {
+            switch (type) {
+                case LogRecordType::BEGIN: return "BEGIN";
+                case LogRecordType::COMMIT: return "COMMIT";
+                case LogRecordType::ABORT: return "ABORT";
+                case LogRecordType::INIT_PAGE: return "INIT_PAGE";
+                case LogRecordType::INSERT: return "INSERT";
+                case LogRecordType::MARK_DELETE: return "MARK_DELETE";
+                case LogRecordType::CLR: return "CLR";
+                case LogRecordType::CHECKPOINT_BEGIN: return "CHECKPOINT_BEGIN";
+                case LogRecordType::CHECKPOINT_DPT: return "CHECKPOINT_DPT";
+                case LogRecordType::CHECKPOINT_END: return "CHECKPOINT_END";
+                default: return "INVALID";
+            }
+        }
+    }
+
+    LogRecord LogRecord::MakeTxnRecord(LogRecordType type) {
+        LogRecord record;
+        record.type_ = type;
+        record.ComputeSize();
+        return record;
+    }
+
+    LogRecord LogRecord::MakeInitPage(PageId page_id, PageId prev_page_id, PageId next_page_id) {
+        LogRecord record;
+        record.type_ = LogRecordType::INIT_PAGE;
+        record.page_id_ = page_id;
+        record.prev_page_id_ = prev_page_id;
+        record.next_page_id_ = next_page_id;
+        record.ComputeSize();
+        return record;
+    }
+
+    LogRecord LogRecord::MakeInsert(PageId page_id, uint16_t slot_id, const Tuple& tuple) {
+        LogRecord record;
+        record.type_ = LogRecordType::INSERT;
+        record.page_id_ = page_id;
+        record.slot_id_ = slot_id;
+        record.tuple_ = tuple;
+        record.ComputeSize();
+        return record;
+    }
+
+    LogRecord LogRecord::MakeMarkDelete(PageId page_id, uint16_t slot_id, uint16_t slot_offset, uint16_t slot_length) {
+        LogRecord record;
+        record.type_ = LogRecordType::MARK_DELETE;
+        record.page_id_ = page_id;
+        record.slot_id_ = slot_id;
+        record.slot_offset_ = slot_offset;
+        record.slot_length_ = slot_length;
+        record.ComputeSize();
+        return record;
+    }
+
+    LogRecord LogRecord::MakeCompensation(const LogRecord& undone, Lsn undo_next_lsn) {
+        LogRecord record;
+        record.type_ = LogRecordType::CLR;
+        record.undone_type_ = undone.type_;
+        record.undo_next_lsn_ = undo_next_lsn;
+        record.page_id_ = undone.page_id_;
+        record.slot_id_ = undone.slot_id_;
+        record.slot_offset_ = undone.slot_offset_;
+        record.slot_length_ = undone.slot_length_;
+        record.ComputeSize();
+        return record;
+    }
+
+    LogRecord LogRecord::MakeCheckpointDpt(std::vector<std::pair<PageId, Lsn>> dirty_pages) {
+        LogRecord record;
+        record.type_ = LogRecordType::CHECKPOINT_DPT;
+        record.dirty_pages_ = std::move(dirty_pages);
+        record.ComputeSize();
+        return record;
+    }
+
+    LogRecord LogRecord::MakeCheckpointEnd(std::vector<std::pair<TxnId, Lsn>> active_txns, TxnId next_txn_id) {
+        LogRecord record;
+        record.type_ = LogRecordType::CHECKPOINT_END;
+        record.active_txns_ = std::move(active_txns);
+        record.next_txn_id_ = next_txn_id;
+        record.ComputeSize();
+        return record;
+    }
+
+    void LogRecord::ComputeSize() {
+        size_t size = HEADER_SIZE;
+        switch (type_) {
+            case LogRecordType::INIT_PAGE:
+                size += sizeof(PageId) * 3;
+                break;
+            case LogRecordType::INSERT:
+                size += sizeof(PageId) + sizeof(uint16_t) + sizeof(uint32_t) + tuple_.GetSize();
+                break;
+            case LogRecordType::MARK_DELETE:
+                size += sizeof(PageId) + sizeof(uint16_t) * 3;
+                break;
+            case LogRecordType::CLR:
+                size += sizeof(Lsn) + sizeof(uint8_t) + sizeof(PageId) + sizeof(uint16_t) * 3;
+                break;
+            case LogRecordType::CHECKPOINT_DPT:
+                size += sizeof(uint32_t) + dirty_pages_.size() * (sizeof(PageId) + sizeof(Lsn));
+                break;
+            case LogRecordType::CHECKPOINT_END:
+                size += sizeof(uint32_t) + active_txns_.size() * (sizeof(TxnId) + sizeof(Lsn)) + sizeof(TxnId);
+                break;
+            default:
+                break;
+        }
+        size_ = static_cast<uint32_t>(size);
+    }
+
+    void LogRecord::SerializeTo(char* buf) const {
+        std::memset(buf, 0, HEADER_SIZE);
+
+        size_t pos = kSizeOffset;
+        Put(buf, &pos, size_);
+        pos = kLsnOffset;
+        Put(buf, &pos, lsn_);
+        Put(buf, &pos, prev_lsn_);
+        Put(buf, &pos, txn_id_);
+        Put(buf, &pos, static_cast<uint8_t>(type_));
+
+        // 본문
+        pos = HEADER_SIZE;
+        switch (type_) {
+            case LogRecordType::INIT_PAGE:
+                Put(buf, &pos, page_id_);
+                Put(buf, &pos, prev_page_id_);
+                Put(buf, &pos, next_page_id_);
+                break;
+            case LogRecordType::INSERT:
+                Put(buf, &pos, page_id_);
+                Put(buf, &pos, slot_id_);
+                Put(buf, &pos, tuple_.GetSize());
+                std::memcpy(buf + pos, tuple_.GetData(), tuple_.GetSize());
+                pos += tuple_.GetSize();
+                break;
+            case LogRecordType::MARK_DELETE:
+                Put(buf, &pos, page_id_);
+                Put(buf, &pos, slot_id_);
+                Put(buf, &pos, slot_offset_);
+                Put(buf, &pos, slot_length_);
+                break;
+            case LogRecordType::CLR:
+                Put(buf, &pos, undo_next_lsn_);
+                Put(buf, &pos, static_cast<uint8_t>(undone_type_));
+                Put(buf, &pos, page_id_);
+                Put(buf, &pos, slot_id_);
+                Put(buf, &pos, slot_offset_);
+                Put(buf, &pos, slot_length_);
+                break;
+            case LogRecordType::CHECKPOINT_DPT:
+                Put(buf, &pos, static_cast<uint32_t>(dirty_pages_.size()));
+                for (const auto& [page_id, rec_lsn] : dirty_pages_) {
+                    Put(buf, &pos, page_id);
+                    Put(buf, &pos, rec_lsn);
+                }
+                break;
+            case LogRecordType::CHECKPOINT_END:
+                Put(buf, &pos, static_cast<uint32_t>(active_txns_.size()));
+                for (const auto& [txn_id, last_lsn] : active_txns_) {
+                    Put(buf, &pos, txn_id);
+                    Put(buf, &pos, last_lsn);
+                }
+                Put(buf, &pos, next_txn_id_);
+                break;
+            default:
+                break;
+        }
+
+        uint32_t checksum = ComputeRecordChecksum(buf, size_);
+        std::memcpy(buf + kChecksumOffset, &checksum, sizeof(checksum));
+    }
+
+    uint32_t LogRecord::PeekSize(const char* buf, size_t available) {
+        if (available < HEADER_SIZE) {
+            return 0;
+        }
+        uint32_t size;
+        std::memcpy(&size, buf + kSizeOffset, sizeof(size));
+        return size < HEADER_SIZE ? 0 : size;
+    }
+
+    bool LogRecord::Deserialize(const char* buf, size_t available, LogRecord* record) {
+        uint32_t size = PeekSize(buf, available);
+        if (size == 0 || size > available) {
+            return false;
+        }
+
+        uint32_t stored_checksum;
+        std::memcpy(&stored_checksum, buf + kChecksumOffset, sizeof(stored_checksum));
+        if (stored_checksum != ComputeRecordChecksum(buf, size)) {
+            return false;
+        }
+
+        LogRecord result;
+        size_t pos = kLsnOffset;
+        result.size_ = size;
+        result.lsn_ = Get<Lsn>(buf, &pos);
+        result.prev_lsn_ = Get<Lsn>(buf, &pos);
+        result.txn_id_ = Get<TxnId>(buf, &pos);
+        result.type_ = static_cast<LogRecordType>(Get<uint8_t>(buf, &pos));
+
+        pos = HEADER_SIZE;
+        switch (result.type_) {
+            case LogRecordType::BEGIN:
+            case LogRecordType::COMMIT:
+            case LogRecordType::ABORT:
+            case LogRecordType::CHECKPOINT_BEGIN:
+                break;
+            case LogRecordType::INIT_PAGE:
+                result.page_id_ = Get<PageId>(buf, &pos);
+                result.prev_page_id_ = Get<PageId>(buf, &pos);
+                result.next_page_id_ = Get<PageId>(buf, &pos);
+                break;
+            case LogRecordType::INSERT: {
+                result.page_id_ = Get<PageId>(buf, &pos);
+                result.slot_id_ = Get<uint16_t>(buf, &pos);
+                auto tuple_size = Get<uint32_t>(buf, &pos);
+                if (pos + tuple_size > size) {
+                    return false;
+                }
+                result.tuple_.Assign(buf + pos, tuple_size);
+                break;
+            }
+            case LogRecordType::MARK_DELETE:
+                result.page_id_ = Get<PageId>(buf, &pos);
+                result.slot_id_ = Get<uint16_t>(buf, &pos);
+                result.slot_offset_ = Get<uint16_t>(buf, &pos);
+                result.slot_length_ = Get<uint16_t>(buf, &pos);
+                break;
+            case LogRecordType::CLR:
+                result.undo_next_lsn_ = Get<Lsn>(buf, &pos);
+                result.undone_type_ = static_cast<LogRecordType>(Get<uint8_t>(buf, &pos));
+                result.page_id_ = Get<PageId>(buf, &pos);
+                result.slot_id_ = Get<uint16_t>(buf, &pos);
+                result.slot_offset_ = Get<uint16_t>(buf, &pos);
+                result.slot_length_ = Get<uint16_t>(buf, &pos);
+                break;
+            case LogRecordType::CHECKPOINT_DPT: {
+                auto count = Get<uint32_t>(buf, &pos);
+                if (pos + count * (sizeof(PageId) + sizeof(Lsn)) > size) {
+                    return false;
+                }
+                result.dirty_pages_.reserve(count);
+                for (uint32_t i = 0; i < count; i++) {
+                    auto page_id = Get<PageId>(buf, &pos);
+                    auto rec_lsn = Get<Lsn>(buf, &pos);
+                    result.dirty_pages_.emplace_back(page_id, rec_lsn);
+                }
+                break;
+            }
+            case LogRecordType::CHECKPOINT_END: {
+                auto count = Get<uint32_t>(buf, &pos);
+                if (pos + count * (sizeof(TxnId) + sizeof(Lsn)) + sizeof(TxnId) > size) {
+                    return false;
+                }
+                result.active_txns_.reserve(count);
+                for (uint32_t i = 0; i < count; i++) {
+                    auto txn_id = Get<TxnId>(buf, &pos);
+                    auto last_lsn = Get<Lsn>(buf, &pos);
+                    result.active_txns_.emplace_back(txn_id, last_lsn);
+                }
+                result.next_txn_id_ = Get<TxnId>(buf, &pos);
+                break;
+            }
+            default:
+                return false;
+        }
+
+        *record = std::move(result);
+        return true;
+    }
+
+    std::string LogRecord::ToString() const {
+        return fmt::format("[lsn={} prev={} txn={} {} page={} slot={}]",
+                           lsn_, prev_lsn_, txn_id_, TypeName(type_), page_id_, slot_id_);
+    }
+}
@@ -0,0 +1,292 @@
+#include "mydb/recovery/LogRecovery.hpp"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    namespace {
+        // 로그를 한 번에 읽어오는 단위
+        constexpr size_t kReadChunkSize = 256 * 1024;
+
+        // 이보다 큰 레코드 크기는 깨진 데이터로 간주
+        constexpr uint32_t kMaxRecordSize = 64 * 1024 * 1024;
+    }
+
+    LogRecovery::LogRecovery(DiskManager* disk_manager, BufferPoolManager* bpm, LogManager* log_manager)
+        : disk_manager_(disk_manager), bpm_(bpm), log_manager_(log_manager) {}
+
+    void LogRecovery::Recover() {
+        active_txns_.clear();
+        dirty_pages_.clear();
+        max_txn_id_ = INVALID_TXN_ID;
+        num_undone_txns_ = 0;
+        num_redone_records_ = 0;
+
+        Analyze();
+        Redo();
+        Undo();
+
+        spdlog::info("Recovery finished: redo {} records, undo {} transactions",
+                     num_redone_records_, num_undone_txns_);
+    }
+
+    bool LogRecovery::ReadRecord(Lsn lsn, LogRecord* record) {
+        auto in_buffer = [&](Lsn pos, size_t length) {
+            return read_buffer_start_ != INVALID_LSN && pos >= read_buffer_start_ &&
+                   pos + length <= read_buffer_start_ + read_buffer_size_;
+        };
+        auto load = [&](Lsn pos, size_t length) {
+            read_buffer_.resize(length);
+            read_buffer_size_ = disk_manager_->ReadLog(read_buffer_.data(), length, pos);
+            read_buffer_start_ = pos;
+        };
+
+        if (!in_buffer(lsn, LogRecord::HEADER_SIZE)) {
+            load(lsn, kReadChunkSize);
+        }
+
+        size_t available = read_buffer_start_ + read_buffer_size_ - lsn;
+        uint32_t size = LogRecord::PeekSize(read_buffer_.data() + (lsn - read_buffer_start_), available);
+        if (size == 0 || size > kMaxRecordSize) {
+            return false;
+        }
+
+        // 레코드가 버퍼 경계에 걸쳐 있으면 레코드 시작 위치부터 다시 읽음
+        if (!in_buffer(lsn, size)) {
+            load(lsn, std::max<size_t>(kReadChunkSize, size));
+        }
+
+        const char* buf = read_buffer_.data() + (lsn - read_buffer_start_);
+        available = read_buffer_start_ + read_buffer_size_ - lsn;
+        return LogRecord::Deserialize(buf, available, record) && record->lsn_ == lsn;
+    }
+
+    void LogRecovery::Analyze() {
+        // 체크포인트가 있으면 거기서부터 분석 시작
+        Lsn start = LOG_HEADER_SIZE;
+        Lsn checkpoint_lsn = log_manager_->GetCheckpointLsn();
+        LogRecord record;
+
+        if (checkpoint_lsn != INVALID_LSN && ReadRecord(checkpoint_lsn, &record) &&
+            record.type_ == LogRecordType::CHECKPOINT_BEGIN) {
+            start = checkpoint_lsn;
+        } else if (checkpoint_lsn != INVALID_LSN) {
+            spdlog::warn("Recovery: checkpoint record at {} is unreadable, scanning the whole log", checkpoint_lsn);
+        }
+
+        // 체크포인트 이후에 끝난 트랜잭션 (END의 활성 트랜잭션 목록에 있어도 loser가 아님)
+        std::unordered_set<TxnId> finished_txns;
+
+        Lsn lsn = start;
+        while (ReadRecord(lsn, &record)) {
+            max_txn_id_ = std::max(max_txn_id_, record.txn_id_);
+
+            switch (record.type_) {
+                case LogRecordType::COMMIT:
+                case LogRecordType::ABORT:
+                    active_txns_.erase(record.txn_id_);
+                    finished_txns.insert(record.txn_id_);
+                    break;
+                case LogRecordType::CHECKPOINT_BEGIN:
+                    break;
+                case LogRecordType::CHECKPOINT_DPT:
+                    // 같은 페이지가 이미 있으면 더 이른 rec_lsn을 유지
+                    for (const auto& [page_id, rec_lsn] : record.dirty_pages_) {
+                        auto [iter, inserted] = dirty_pages_.emplace(page_id, rec_lsn);
+                        if (!inserted) {
+                            iter->second = std::min(iter->second, rec_lsn);
+                        }
+                    }
+                    break;
+                case LogRecordType::CHECKPOINT_END:
+                    for (const auto& [txn_id, last_lsn] : record.active_txns_) {
+                        if (finished_txns.count(txn_id) > 0) {
+                            continue;
+                        }
+                        auto [iter, inserted] = active_txns_.emplace(txn_id, last_lsn);
+                        if (!inserted) {
+                            iter->second = std::max(iter->second, last_lsn);
+                        }
+                    }
+                    if (record.next_txn_id_ > 0) {
+                        max_txn_id_ = std::max(max_txn_id_, record.next_txn_id_ - 1);
+                    }
+                    break;
+                case LogRecordType::INIT_PAGE:
+                case LogRecordType::INSERT:
+                case LogRecordType::MARK_DELETE:
+                case LogRecordType::CLR:
+                    // 체크포인트 이후 처음 수정된 페이지는 이 레코드가 rec_lsn
+                    dirty_pages_.emplace(record.page_id_, lsn);
+                    [[fallthrough]];
+                default:
+                    if (record.txn_id_ != INVALID_TXN_ID) {
+                        active_txns_[record.txn_id_] = lsn;
+                    }
+                    break;
+            }
+
+            lsn += record.size_;
+        }
+
+        // 여기가 유효한 로그의 끝. 그 뒤(크래시로 반쯤 쓰인 레코드 등)는 잘라냄
+        log_end_ = lsn;
+        log_manager_->ResetAfterRecovery(log_end_, max_txn_id_ + 1);
+
+        // redo 시작점 = 체크포인트 시점 dirty 페이지들 중 가장 오래된 rec_lsn (없으면 체크포인트 위치)
+        redo_start_lsn_ = start;
+        for (const auto& [page_id, rec_lsn] : dirty_pages_) {
+            redo_start_lsn_ = std::min(redo_start_lsn_, std::max<Lsn>(rec_lsn, LOG_HEADER_SIZE));
+        }
+    }
+
+    void LogRecovery::Redo() {
+        Lsn lsn = redo_start_lsn_;
+        LogRecord record;
+
+        while (lsn < log_end_ && ReadRecord(lsn, &record)) {
+            switch (record.type_) {
+                case LogRecordType::INIT_PAGE:
+                case LogRecordType::INSERT:
+                case LogRecordType::MARK_DELETE:
+                case LogRecordType::CLR: {
+                    // DPT에 없거나 rec_lsn 이전의 레코드는 이미 디스크에 반영된 것 -> 페이지를 읽지도 않고 건너뜀
+                    auto iter = dirty_pages_.find(record.page_id_);
+                    if (iter != dirty_pages_.end() && lsn >= iter->second) {
+                        ApplyRedo(record);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+            lsn += record.size_;
+        }
+    }
+
+    void LogRecovery::Undo() {
+        // CLR, ABORT를 loser 트랜잭션의 체인에 이어 붙이기 위해 같은 ID로 복원
+        std::unordered_map<TxnId, Transaction> losers;
+
+        // ToUndo: loser마다 다음에 되돌릴 레코드의 LSN. 모든 loser를 통틀어 LSN이 큰 것부터 처리해야
+        // 같은 페이지/슬롯을 건드린 loser들이 기록된 역순으로 정확히 되돌려짐
+        std::priority_queue<std::pair<Lsn, TxnId>> to_undo;
+        for (const auto& [txn_id, last_lsn] : active_txns_) {
+            Transaction txn(txn_id);
+            txn.set_prev_lsn(last_lsn);
+            losers.emplace(txn_id, txn);
+            to_undo.emplace(last_lsn, txn_id);
+        }
+
+        LogRecord record;
+        while (!to_undo.empty()) {
+            auto [lsn, txn_id] = to_undo.top();
+            to_undo.pop();
+            Transaction& txn = losers.at(txn_id);
+
+            Lsn next_lsn;
+            if (!ReadRecord(lsn, &record)) {
+                spdlog::error("Recovery: failed to read log record at {} while undoing txn {}", lsn, txn_id);
+                next_lsn = INVALID_LSN;
+            } else {
+                switch (record.type_) {
+                    case LogRecordType::INSERT:
+                    case LogRecordType::MARK_DELETE: {
+                        // 되돌리는 작업도 로그로 남긴 뒤 적용
+                        LogRecord clr = LogRecord::MakeCompensation(record, record.prev_lsn_);
+                        log_manager_->AppendLogRecord(&clr, &txn);
+                        ApplyRedo(clr);
+                        next_lsn = record.prev_lsn_;
+                        break;
+                    }
+                    case LogRecordType::CLR:
+                        // 이미 되돌린 작업은 건너뜀
+                        next_lsn = record.undo_next_lsn_;
+                        break;
+                    case LogRecordType::BEGIN:
+                        next_lsn = INVALID_LSN;
+                        break;
+                    default:
+                        // INIT_PAGE: 초기화된 빈 페이지가 남아 있어도 무해하므로 되돌리지 않음
+                        next_lsn = record.prev_lsn_;
+                        break;
+                }
+            }
+
+            if (next_lsn != INVALID_LSN) {
+                to_undo.emplace(next_lsn, txn_id);
+                continue;
+            }
+
+            // 체인 끝(BEGIN)까지 되돌린 loser는 ABORT로 마무리
+            LogRecord abort_record = LogRecord::MakeTxnRecord(LogRecordType::ABORT);
+            log_manager_->AppendLogRecord(&abort_record, &txn);
+            num_undone_txns_++;
+        }
+
+        log_manager_->FlushAll();
+    }
+
+    void LogRecovery::ApplyRedo(const LogRecord& record) {
+        EnsurePageExists(record.page_id_);
+
+        Page* page = bpm_->FetchPage(record.page_id_);
+        if (page == nullptr) {
+            throw std::runtime_error("Recovery: no free frame in buffer pool");
+        }
+
+        // 이미 반영된 변경
+        if (page->get_lsn() >= record.lsn_) {
+            bpm_->UnpinPage(record.page_id_, false);
+            return;
+        }
+
+        auto* table_page = reinterpret_cast<TablePage*>(page);
+
+        switch (record.type_) {
+            case LogRecordType::INIT_PAGE:
+                table_page->Init(record.page_id_, record.prev_page_id_, record.next_page_id_);
+                break;
+            case LogRecordType::INSERT: {
+                uint16_t slot_id;
+                if (!table_page->InsertTuple(record.tuple_, &slot_id) || slot_id != record.slot_id_) {
+                    // 이후 CLR, MARK_DELETE가 이 슬롯 번호를 가리키므로 계속 진행하면 틀린 상태로 끝남
+                    bpm_->UnpinPage(record.page_id_, false);
+                    throw std::runtime_error("Recovery: redo of " + record.ToString() + " did not land in slot " +
+                                             std::to_string(record.slot_id_));
+                }
+                break;
+            }
+            case LogRecordType::MARK_DELETE:
+                table_page->MarkDelete(record.slot_id_);
+                break;
+            case LogRecordType::CLR:
+                if (record.undone_type_ == LogRecordType::INSERT) {
+                    table_page->MarkDelete(record.slot_id_);
+                } else if (record.undone_type_ == LogRecordType::MARK_DELETE) {
+                    table_page->RestoreSlot(record.slot_id_, record.slot_offset_, record.slot_length_);
+                }
+                break;
+            default:
+                break;
+        }
+
+        page->set_lsn(record.lsn_);
+        bpm_->UnpinPage(record.page_id_, true);
+        num_redone_records_++;
+    }
+
+    void LogRecovery::EnsurePageExists(PageId page_id) {
+        // AllocatePage는 free list의 페이지를 먼저 내주므로 쓰면 안 됨 (free 페이지가 빠져나가 누수)
+        if (disk_manager_->GetNumPages() <= page_id) {
+            disk_manager_->ExtendToPage(page_id);
+        }
+    }
+}
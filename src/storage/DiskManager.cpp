@@ -1,115 +1,321 @@
 #include "mydb/storage/DiskManager.hpp"
 #include <spdlog/spdlog.h> // 로깅
+#include <fmt/format.h>
+#include <algorithm>
 #include <stdexcept>       // 예외처리
 #include <filesystem>      // 파일 존재여부 확인용
 
-namespace mydb {
+#include <fcntl.h>         // open
+#include <sys/mman.h>      // mmap, madvise
+#include <unistd.h>        // pread, pwrite, fdatasync
 
-    // 생성자 구현
-    DiskManager::DiskManager(const std::string& db_file) : file_name_(db_file) {
-        bool exists = std::filesystem::exists(file_name_);
-
-        if (!exists) {
-            // 파일이 없으면: 출력 전용(ofstream)으로 열어서 "생성"만 하고 바로 닫음
-            std::ofstream out(file_name_, std::ios::binary);
-            if (!out.is_open()) {
-                throw std::runtime_error("Failed to create new file: " + file_name_ +
-                                       " | Error: " + std::strerror(errno));
-            }
+#include "mydb/common/Crc32c.hpp"
 
-            out.close();
-            spdlog::info("Created new database file: {}", file_name_);
-        }
+namespace mydb {
 
-        db_io_.open(file_name_, std::ios::binary | std::ios::in | std::ios::out);
+    PageCorruptionError::PageCorruptionError(PageId page_id, uint32_t stored, uint32_t computed)
+        : std::runtime_error(fmt::format("Page {} checksum mismatch (stored: {:#010x}, computed: {:#010x})",
+                                         page_id, stored, computed)),
+          page_id_(page_id) {}
 
-        if (!db_io_.is_open()) {
-            throw std::runtime_error("Failed to open file: " + file_name_ +
-                                   " | Error: " + std::strerror(errno));
-        }
+    uint32_t DiskManager::ComputeChecksum(PageId page_id, const char* data) {
+        // PageId는 64비트라 시드(32비트)로 바로 넘기면 상위 절반이 잘림 -> 8바이트 전체를 먼저 CRC로 접음
+        uint32_t seed = Crc32c(&page_id, sizeof(page_id));
+        return Crc32c(data, PAGE_CHECKSUM_OFFSET, seed);
     }
 
+    // 생성자 구현
+    DiskManager::DiskManager(const std::string& db_file, const TablespaceOptions& options)
+        : file_name_(db_file),
+          log_name_(std::filesystem::path(db_file).replace_extension(".log").string()),
+          tablespace_(db_file, options),
+          allocator_(&tablespace_, std::filesystem::path(db_file).replace_extension(".fsm").string()),
+          temp_pages_(&allocator_, std::filesystem::path(db_file).replace_extension(".spill").string(),
+                      options.read_only) {}
+
     //소멸자: 객체가 메모리에서 사라질 때 자동 호출
     DiskManager::~DiskManager() {
         ShutDown();
     }
 
     void DiskManager::ShutDown() {
-        if (db_io_.is_open()) {
-            db_io_.close();
+        UnmapFile();
+
+        // 읽기 전용: 파일 크기도 free list도 건드리지 않음
+        if (!shut_down_ && !tablespace_.is_read_only()) {
+            shut_down_ = true;
+            try {
+                temp_pages_.Release(); // 임시 페이지는 다음 실행에 필요 없으므로 free list로
+                tablespace_.TrimToNumPages();
+                allocator_.Save();
+            } catch (const std::exception& e) {
+                // 실패해도 다음 실행에서 free list 없이 시작할 뿐 (해제된 페이지가 재사용되지 않음)
+                spdlog::error("Failed to save page allocation state: {}", e.what());
+            }
+        }
+
+        tablespace_.Close();
+
+        std::scoped_lock lock(log_io_mutex_);
+        if (log_fd_ >= 0) {
+            ::close(log_fd_);
+            log_fd_ = -1;
         }
     }
 
     void DiskManager::WritePage(PageId page_id, const Page& page) {
-        // Lock: 이 블록이 끝날때까지 다른 스레드는 대기
-        std::scoped_lock lock(db_io_mutex_);
+        if (tablespace_.is_read_only()) {
+            throw std::runtime_error("WritePage: " + file_name_ + " is opened read-only");
+        }
 
-        // 1. 파일 내 위치 계산 (Offset)
-        // 오,,, 파일도 결국 binary 모음. 여러 페이지 데이터가 붙어있고, 거기서 현재 페이지의 시작점을 찾아야 함.
-        // 텍스트 파일 떠올려도 될듯.
-        size_t offset = static_cast<size_t>(page_id) * PAGE_SIZE;
+        ScopedLatencyTimer timer(metrics_.write_latency);
+        metrics_.pages_written.Add();
 
-        // 2. 커서 이동 (Seek)
-        // seekp = seek put = 쓸 위치로 이동
-        db_io_.seekp(offset);
+        // page는 const라서 트레일러를 직접 못 고침 -> 체크섬만 따로 넘겨서 같이 씀
+        // 파일별 pwrite라 다른 페이지의 읽기/쓰기와 락을 공유하지 않음
+        uint32_t checksum = ComputeChecksum(page_id, page.get_data());
+        tablespace_.WritePage(page_id, page.get_data(), checksum);
+    }
 
-        // 3. 데이터 쓰기 (혹시 이미 데이터가 있던 페이지라면, overwrite)
-        // reinterpret_cast? 이해 안 갔음
-        db_io_.write(page.get_data(), PAGE_SIZE);
+    void DiskManager::ReadPage(PageId page_id, Page& page) {
+        ScopedLatencyTimer timer(metrics_.read_latency);
+        metrics_.pages_read.Add();
 
-        // 4. 즉시 디스크 반영(Flush) (영속화)
-        db_io_.flush();
+        // 범위 밖이면 예외 (AllocatePage로 늘린 적 없는 페이지)
+        tablespace_.ReadPage(page_id, page.get_data());
 
-        // 아 락은 저렇게 얻어오면, 블록 끝나면 자동해제인가봄.
+        // 체크섬 검증
+        VerifyChecksum(page_id, page.get_data());
     }
 
-    void DiskManager::ReadPage(PageId page_id, Page& page) {
-        std::scoped_lock lock(db_io_mutex_); //읽기 쓰기 구분없는 락인가봄.
+    PageId DiskManager::ReadPages(PageId first, PageId count, char* data) {
+        ScopedLatencyTimer timer(metrics_.batch_read_latency);
+
+        PageId read = tablespace_.ReadPages(first, count, data);
+        metrics_.pages_read.Add(read);
+        return read;
+    }
 
-        size_t offset = static_cast<size_t>(page_id) * PAGE_SIZE;
+    void DiskManager::VerifyChecksum(PageId page_id, const char* data) {
+        uint32_t stored;
+        std::memcpy(&stored, data + PAGE_CHECKSUM_OFFSET, sizeof(stored));
+        uint32_t computed = ComputeChecksum(page_id, data);
+        if (stored != computed) {
+            // AllocatePage로 늘리기만 하고 아직 한 번도 안 쓴 페이지는 전부 0 -> 정상으로 취급
+            bool all_zero = std::all_of(data, data + PAGE_SIZE, [](char c) { return c == 0; });
+            if (!all_zero) {
+                spdlog::error("Checksum mismatch on page {} (stored: {:#010x}, computed: {:#010x})",
+                              page_id, stored, computed);
+                throw PageCorruptionError(page_id, stored, computed);
+            }
+        }
+    }
 
-        // 파일 크기 체크 (읽으려는 위치가 파일 끝보다 뒤면 안되니까)
-        db_io_.seekg(0, std::ios::end); // 끝으로 이동
-        size_t file_size = db_io_.tellg(); // 현재 위치(크기)
+    // 다음 페이지 ID 할당 (free list -> high-water mark 순)
+    PageId DiskManager::AllocatePage() {
+        if (tablespace_.is_read_only()) {
+            throw std::runtime_error("AllocatePage: " + file_name_ + " is opened read-only");
+        }
+        return allocator_.Allocate();
+    }
 
-        if (offset >= file_size) {
-            throw std::runtime_error("ReadPage: PageId out of bound");
+    bool DiskManager::DeallocatePage(PageId page_id) {
+        if (tablespace_.is_read_only()) {
+            return false;
+        }
+        // 임시 페이지가 일반 free list에 들어가면, 크래시 후 .spill에서 한 번 더 반납돼 일반 페이지를 지울 수 있음
+        if (temp_pages_.IsTempPage(page_id)) {
+            spdlog::warn("DeallocatePage: page {} is a temporary page (use DeallocateTempPage)", page_id);
+            return false;
         }
+        return allocator_.Free(page_id);
+    }
 
-        // seekg = seek get = 읽을 위치로 이동
-        db_io_.seekg(offset);
+    PageId DiskManager::AllocateTempPage() {
+        if (tablespace_.is_read_only()) {
+            throw std::runtime_error("AllocateTempPage: " + file_name_ + " is opened read-only");
+        }
+        return temp_pages_.Allocate();
+    }
 
-        // 데이터 읽어서 page 변수에 채워넣기
-        // 읽어서 수정해야 하므로 const_cast 하지 않음
-        db_io_.read(page.get_data(), PAGE_SIZE);
+    bool DiskManager::DeallocateTempPage(PageId page_id) {
+        return temp_pages_.Free(page_id);
+    }
 
-        // 읽은 바이트 수 확인
-        if (db_io_.bad() || db_io_.fail()) {
-            spdlog::error("I/O error while reading page {}", page_id);
+    void DiskManager::ExtendToPage(PageId page_id) {
+        if (tablespace_.is_read_only()) {
+            throw std::runtime_error("ExtendToPage: " + file_name_ + " is opened read-only");
         }
+        tablespace_.GrowNumPages(page_id + 1);
     }
 
-    // 다음 페이지 ID 할당 (단순히 파일 크기 늘리는 역할)
-    PageId DiskManager::AllocatePage() {
-        std::scoped_lock lock(db_io_mutex_);
+    PageId DiskManager::GetNumPages() {
+        return tablespace_.GetNumPages();
+    }
 
-        // 현재 파일 끝으로 이동
-        db_io_.seekp(0, std::ios::end);
-        size_t file_size = db_io_.tellp();
+    void DiskManager::OpenLogIfNeeded() {
+        if (log_fd_ >= 0) {
+            return;
+        }
 
-        // 현재 몇 번째 페이지까지 있는지 계산
-        PageId next_page_id = file_size / PAGE_SIZE;
+        log_fd_ = ::open(log_name_.c_str(), O_RDWR | O_CREAT, 0644);
+        if (log_fd_ < 0) {
+            throw std::runtime_error("Failed to open log file: " + log_name_ +
+                                   " | Error: " + std::strerror(errno));
+        }
+    }
 
-        // 모던 C++ 방식 : vector, array 사용(스택 오버플로우 방지)
-        std::vector<char> buf(PAGE_SIZE, 0);
+    void DiskManager::WriteLog(const char* data, size_t size, size_t offset) {
+        std::scoped_lock lock(log_io_mutex_);
+        OpenLogIfNeeded();
 
-        db_io_.write(buf.data(), PAGE_SIZE);
-        // // 파일 크기를 16KB만큼 늘리기 위해 0으로 채운 데이터 사용
-        // // 임시 버퍼(모두 0)
-        // char buf[PAGE_SIZE] = {0};
-        // db_io_.write(buf, PAGE_SIZE);
-        db_io_.flush();
+        // pwrite는 일부만 쓰고 돌아올 수 있으므로 다 쓸 때까지 반복
+        size_t written = 0;
+        while (written < size) {
+            ssize_t n = ::pwrite(log_fd_, data + written, size - written, offset + written);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::runtime_error("WriteLog failed | Error: " + std::string(std::strerror(errno)));
+            }
+            written += static_cast<size_t>(n);
+        }
+    }
+
+    size_t DiskManager::ReadLog(char* data, size_t size, size_t offset) {
+        std::scoped_lock lock(log_io_mutex_);
+        OpenLogIfNeeded();
 
-        return next_page_id;
+        size_t total = 0;
+        while (total < size) {
+            ssize_t n = ::pread(log_fd_, data + total, size - total, offset + total);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::runtime_error("ReadLog failed | Error: " + std::string(std::strerror(errno)));
+            }
+            if (n == 0) {
+                break; // 파일 끝
+            }
+            total += static_cast<size_t>(n);
+        }
+        return total;
+    }
+
+    void DiskManager::SyncLog() {
+        int fd;
+        {
+            std::scoped_lock lock(log_io_mutex_);
+            OpenLogIfNeeded();
+            fd = log_fd_;
+        }
+
+        // fsync 동안 다른 로그 읽기/쓰기를 막을 필요는 없으므로 락 밖에서 호출
+        if (::fdatasync(fd) != 0) {
+            throw std::runtime_error("SyncLog failed | Error: " + std::string(std::strerror(errno)));
+        }
+    }
+
+    size_t DiskManager::GetLogSize() {
+        std::scoped_lock lock(log_io_mutex_);
+        OpenLogIfNeeded();
+
+        off_t size = ::lseek(log_fd_, 0, SEEK_END);
+        if (size < 0) {
+            throw std::runtime_error("GetLogSize failed | Error: " + std::string(std::strerror(errno)));
+        }
+        return static_cast<size_t>(size);
+    }
+
+    void DiskManager::TruncateLog(size_t size) {
+        std::scoped_lock lock(log_io_mutex_);
+        OpenLogIfNeeded();
+
+        if (::ftruncate(log_fd_, static_cast<off_t>(size)) != 0) {
+            throw std::runtime_error("TruncateLog failed | Error: " + std::string(std::strerror(errno)));
+        }
+    }
+
+    namespace {
+        int ToMadvise(AccessPattern pattern) {
+            switch (pattern) {
+                case AccessPattern::SEQUENTIAL:
+                    return MADV_SEQUENTIAL;
+                case AccessPattern::RANDOM:
+                    return MADV_RANDOM;
+                default:
+                    return MADV_NORMAL;
+            }
+        }
+    }
+
+    PageId DiskManager::MapFile(AccessPattern pattern) {
+        UnmapFile();
+
+        // 페이지가 여러 파일에 흩어져 있으면 한 매핑에서 page_id * PAGE_SIZE로 찾을 수 없음
+        if (tablespace_.get_num_files() != 1) {
+            throw std::runtime_error("Read-only mapping requires a single-file tablespace: " + file_name_);
+        }
+
+        PageId num_pages = tablespace_.GetNumPages();
+        if (num_pages == 0) {
+            return 0;
+        }
+
+        // 매핑은 fd를 닫아도 유지되므로 매핑용으로 잠깐만 엶
+        int fd = ::open(file_name_.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open file for mapping: " + file_name_ +
+                                   " | Error: " + std::strerror(errno));
+        }
+
+        size_t map_size = static_cast<size_t>(num_pages) * PAGE_SIZE;
+        void* addr = ::mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("Failed to map file: " + file_name_ +
+                                   " | Error: " + std::strerror(errno));
+        }
+
+        mapping_ = static_cast<char*>(addr);
+        num_mapped_pages_ = num_pages;
+        AdviseMapping(pattern);
+
+        spdlog::info("Mapped {} pages of {} read-only", num_pages, file_name_);
+        return num_pages;
+    }
+
+    void DiskManager::UnmapFile() {
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, static_cast<size_t>(num_mapped_pages_) * PAGE_SIZE);
+            mapping_ = nullptr;
+            num_mapped_pages_ = 0;
+        }
+    }
+
+    void DiskManager::AdviseMapping(AccessPattern pattern, PageId first, PageId count) {
+        if (mapping_ == nullptr || first >= num_mapped_pages_) {
+            return;
+        }
+        if (count == 0 || count > num_mapped_pages_ - first) {
+            count = num_mapped_pages_ - first;
+        }
+
+        // 힌트일 뿐이므로 실패해도 동작에는 영향 없음
+        if (::madvise(mapping_ + static_cast<size_t>(first) * PAGE_SIZE,
+                      static_cast<size_t>(count) * PAGE_SIZE, ToMadvise(pattern)) != 0) {
+            spdlog::warn("madvise failed on {}: {}", file_name_, std::strerror(errno));
+        }
+    }
+
+    void DiskManager::PrefetchMapping(PageId first, PageId count) {
+        if (mapping_ == nullptr || first >= num_mapped_pages_) {
+            return;
+        }
+        count = std::min(count, num_mapped_pages_ - first);
+        ::madvise(mapping_ + static_cast<size_t>(first) * PAGE_SIZE,
+                  static_cast<size_t>(count) * PAGE_SIZE, MADV_WILLNEED);
     }
-}
\ No newline at end of file
+}
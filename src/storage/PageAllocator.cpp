@@ -0,0 +1,201 @@
+#include "mydb/storage/PageAllocator.hpp"
+
+#include <spdlog/spdlog.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "mydb/common/Crc32c.hpp"
+
+namespace mydb {
+
+    namespace {
+        // fsm 파일: [magic 8][version 4][crc32c 4][high-water mark 8][count 8][PageId x count]
+        constexpr char FSM_MAGIC[8] = {'M', 'Y', 'D', 'B', 'F', 'S', 'M', '\0'};
+        constexpr uint32_t FSM_VERSION = 1;
+        constexpr size_t FSM_HEADER_SIZE = sizeof(FSM_MAGIC) + sizeof(uint32_t) * 2 + sizeof(uint64_t) * 2;
+    }
+
+    PageAllocator::PageAllocator(Tablespace* tablespace, std::string fsm_path)
+        : tablespace_(tablespace), fsm_path_(std::move(fsm_path)) {
+        // 읽기 전용이면 할당/해제가 없으므로 free list가 필요 없음 (.fsm은 쓰는 쪽이 다음에 열 때를 위해 그대로 둠)
+        if (!tablespace_->is_read_only()) {
+            Load();
+        }
+    }
+
+    PageId PageAllocator::Allocate() {
+        PageId page_id;
+        if (num_free_.load(std::memory_order_relaxed) > 0 && PopFree(&page_id)) {
+            metrics_.reused.Add();
+            return page_id;
+        }
+
+        metrics_.allocated.Add();
+        return tablespace_->AllocatePage();
+    }
+
+    bool PageAllocator::PopFree(PageId* page_id) {
+        // 자기 샤드부터, 비어 있으면 다음 샤드들
+        size_t home = CurrentMetricsShard();
+        for (size_t i = 0; i < METRICS_SHARDS; i++) {
+            Shard& shard = shards_[(home + i) % METRICS_SHARDS];
+            std::scoped_lock lock(shard.mutex_);
+            if (!shard.pages_.empty()) {
+                *page_id = shard.pages_.back();
+                shard.pages_.pop_back();
+                shard.SetFree(*page_id, false);
+                num_free_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool PageAllocator::Free(PageId page_id) {
+        if (page_id >= tablespace_->GetNumPages()) {
+            spdlog::warn("PageAllocator: ignoring free of unallocated page {}", page_id);
+            return false;
+        }
+
+        Shard& shard = shards_[ShardOf(page_id)];
+        {
+            std::scoped_lock lock(shard.mutex_);
+            if (shard.SetFree(page_id, true)) {
+                spdlog::warn("PageAllocator: ignoring double free of page {}", page_id);
+                return false;
+            }
+            shard.pages_.push_back(page_id);
+        }
+        num_free_.fetch_add(1, std::memory_order_relaxed);
+        metrics_.freed.Add();
+        return true;
+    }
+
+    bool PageAllocator::IsFree(PageId page_id) const {
+        const Shard& shard = shards_[ShardOf(page_id)];
+        std::scoped_lock lock(shard.mutex_);
+        size_t bit = static_cast<size_t>(page_id / METRICS_SHARDS);
+        return bit / 64 < shard.free_bits_.size() && (shard.free_bits_[bit / 64] >> (bit % 64) & 1) != 0;
+    }
+
+    bool PageAllocator::Shard::SetFree(PageId page_id, bool free) {
+        size_t bit = static_cast<size_t>(page_id / METRICS_SHARDS);
+        if (bit / 64 >= free_bits_.size()) {
+            if (!free) {
+                return false;
+            }
+            free_bits_.resize(bit / 64 + 1, 0);
+        }
+        uint64_t mask = uint64_t{1} << (bit % 64);
+        bool was_free = (free_bits_[bit / 64] & mask) != 0;
+        if (free) {
+            free_bits_[bit / 64] |= mask;
+        } else {
+            free_bits_[bit / 64] &= ~mask;
+        }
+        return was_free;
+    }
+
+    void PageAllocator::Save() {
+        std::vector<PageId> pages;
+        for (auto& shard : shards_) {
+            std::scoped_lock lock(shard.mutex_);
+            pages.insert(pages.end(), shard.pages_.begin(), shard.pages_.end());
+        }
+
+        // 해제된 페이지가 없으면 파일 크기만으로 충분 (이전 실행의 파일은 Load에서 이미 지움)
+        if (pages.empty()) {
+            return;
+        }
+
+        uint64_t num_pages = tablespace_->GetNumPages();
+        uint64_t count = pages.size();
+        uint32_t crc = Crc32c(&num_pages, sizeof(num_pages));
+        crc = Crc32c(pages.data(), pages.size() * sizeof(PageId), crc);
+
+        // 쓰다가 죽으면 이전 파일도 없는 상태 = free list 없이 시작 (안전한 쪽)
+        std::string tmp_path = fsm_path_ + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                throw std::runtime_error("Failed to open free page file: " + tmp_path +
+                                         " | Error: " + std::strerror(errno));
+            }
+            out.write(FSM_MAGIC, sizeof(FSM_MAGIC));
+            out.write(reinterpret_cast<const char*>(&FSM_VERSION), sizeof(FSM_VERSION));
+            out.write(reinterpret_cast<const char*>(&crc), sizeof(crc));
+            out.write(reinterpret_cast<const char*>(&num_pages), sizeof(num_pages));
+            out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            out.write(reinterpret_cast<const char*>(pages.data()), static_cast<std::streamsize>(count * sizeof(PageId)));
+            if (!out.good()) {
+                throw std::runtime_error("Failed to write free page file: " + tmp_path);
+            }
+        }
+        std::filesystem::rename(tmp_path, fsm_path_);
+    }
+
+    void PageAllocator::Load() {
+        std::ifstream in(fsm_path_, std::ios::binary);
+        if (!in.is_open()) {
+            return;
+        }
+
+        std::vector<PageId> pages;
+        uint64_t num_pages = 0;
+        bool valid = false;
+
+        char header[FSM_HEADER_SIZE];
+        if (in.read(header, sizeof(header)) && std::memcmp(header, FSM_MAGIC, sizeof(FSM_MAGIC)) == 0) {
+            uint32_t version;
+            uint32_t crc;
+            uint64_t count;
+            size_t pos = sizeof(FSM_MAGIC);
+            std::memcpy(&version, header + pos, sizeof(version));
+            pos += sizeof(version);
+            std::memcpy(&crc, header + pos, sizeof(crc));
+            pos += sizeof(crc);
+            std::memcpy(&num_pages, header + pos, sizeof(num_pages));
+            pos += sizeof(num_pages);
+            std::memcpy(&count, header + pos, sizeof(count));
+
+            if (version == FSM_VERSION && count <= tablespace_->GetNumPages()) {
+                pages.resize(count);
+                if (in.read(reinterpret_cast<char*>(pages.data()), static_cast<std::streamsize>(count * sizeof(PageId)))) {
+                    uint32_t computed = Crc32c(&num_pages, sizeof(num_pages));
+                    computed = Crc32c(pages.data(), pages.size() * sizeof(PageId), computed);
+                    valid = computed == crc;
+                }
+            }
+        }
+        in.close();
+
+        // 이번 실행이 크래시로 끝나면 이 free list는 낡은 정보가 되므로, 읽자마자 지움
+        std::filesystem::remove(fsm_path_);
+
+        if (!valid) {
+            spdlog::warn("PageAllocator: {} is corrupted, starting without free pages", fsm_path_);
+            return;
+        }
+
+        // 파일을 미리 늘려두고 안 쓴 페이지는 다시 내줄 수 있게
+        tablespace_->RestoreNumPages(num_pages);
+
+        size_t loaded = 0;
+        for (PageId page_id : pages) {
+            if (page_id >= tablespace_->GetNumPages()) {
+                continue; // DB 파일이 바뀐 경우
+            }
+            Shard& shard = shards_[ShardOf(page_id)];
+            if (shard.SetFree(page_id, true)) {
+                continue; // 중복된 ID (두 번 넣으면 같은 페이지를 두 번 내주게 됨)
+            }
+            shard.pages_.push_back(page_id);
+            loaded++;
+        }
+        num_free_.store(loaded, std::memory_order_relaxed);
+        spdlog::debug("PageAllocator: loaded {} free pages from {}", loaded, fsm_path_);
+    }
+}
@@ -1,13 +1,30 @@
 #include "mydb/storage/TablePage.hpp"
+#include "mydb/recovery/LogManager.hpp"
 
 namespace mydb {
+
+    void TablePage::Init(PageId page_id, PageId prev_id, PageId next_id, Transaction* txn, LogManager* log_manager) {
+        // WAL: 페이지를 바꾸기 전에 로그부터
+        if (txn != nullptr && log_manager != nullptr) {
+            LogRecord record = LogRecord::MakeInitPage(page_id, prev_id, next_id);
+            set_lsn(log_manager->AppendLogRecord(&record, txn));
+        }
+
+        // 헤더 객체 가져오기 (메모리 재해석?)
+        auto* header = GetHeader();
+
+        header->next_page_id_ = next_id;
+        header->prev_page_id_ = prev_id;
+        header->num_slots_ = 0;
+        header->free_space_pointer_ = PAGE_TRAILER_OFFSET; // 데이터 영역은 맨 끝(트레일러 직전)부터
+    }
     /**
      *
      * @param tuple 페이지에 삽입할 row 단위의 실제 데이터
      * @param slot_id 할당된 슬롯 번호를 저장해서 돌려줌.
      * @return 성공여부
      */
-    bool TablePage::InsertTuple(const Tuple& tuple, uint16_t* slot_id) {
+    bool TablePage::InsertTuple(const Tuple& tuple, uint16_t* slot_id, Transaction* txn, LogManager* log_manager) {
         // 필요한 공간 계산(데이터 공간 크기 + 추가될 슬롯 하나 크기)
         uint32_t needed_space = tuple.GetSize() + sizeof(Slot);
 
@@ -20,6 +37,12 @@ namespace mydb {
         auto* header = GetHeader();
         auto* slots = GetSlotArray();
 
+        // 로그 기록 (redo 시 같은 슬롯 번호로 다시 들어가야 하므로 슬롯 번호도 같이 남김)
+        if (txn != nullptr && log_manager != nullptr) {
+            LogRecord record = LogRecord::MakeInsert(get_page_id(), header->num_slots_, tuple);
+            set_lsn(log_manager->AppendLogRecord(&record, txn));
+        }
+
         // 빈 공간과 데이터 영역의 경계선을 새로 추가될 튜플을 반영해서, 더 위(앞? 더 낮은 주소값)로 옮김
         header->free_space_pointer_ -= tuple.GetSize();
 
@@ -44,7 +67,7 @@ namespace mydb {
         return true;
     }
 
-    bool TablePage::GetTuple(uint16_t slot_id, Tuple* tuple) {
+    bool TablePage::GetTuple(uint16_t slot_id, Tuple* tuple, TupleArena* arena) {
         auto* header = GetHeader();
 
         // 1. 범위체크
@@ -59,12 +82,12 @@ namespace mydb {
         }
 
         // 3. 조회 (복사)
-        *tuple = Tuple(get_data() + slot.offset_, slot.length_);
+        tuple->Assign(get_data() + slot.offset_, slot.length_, arena);
 
         return true;
     }
 
-    bool TablePage::MarkDelete(uint16_t slot_id) {
+    bool TablePage::MarkDelete(uint16_t slot_id, Transaction* txn, LogManager* log_manager) {
         auto* header = GetHeader();
 
         // 1, 범위 체크
@@ -78,6 +101,12 @@ namespace mydb {
             return false;
         }
 
+        // undo할 때 슬롯을 되살릴 수 있도록 삭제 전 슬롯 정보를 남김
+        if (txn != nullptr && log_manager != nullptr) {
+            LogRecord record = LogRecord::MakeMarkDelete(get_page_id(), slot_id, slot.offset_, slot.length_);
+            set_lsn(log_manager->AppendLogRecord(&record, txn));
+        }
+
         // 3. 마킹(soft delete)
         slot.length_ = 0;
         slot.offset_ = 0;
@@ -88,5 +117,9 @@ namespace mydb {
         return true;
     }
 
-
-}
\ No newline at end of file
+    void TablePage::RestoreSlot(uint16_t slot_id, uint16_t offset, uint16_t length) {
+        Slot& slot = GetSlotArray()[slot_id];
+        slot.offset_ = offset;
+        slot.length_ = length;
+    }
+}
@@ -0,0 +1,309 @@
+#include "mydb/storage/Tablespace.hpp"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>   // open
+#include <sys/uio.h> // pwritev
+#include <unistd.h>  // pread, pwrite, fdatasync
+
+namespace mydb {
+
+    namespace {
+        // 일부만 읽고 돌아올 수 있으므로 다 읽거나 파일 끝까지 반복. 읽은 바이트 수 반환
+        size_t PreadFull(int fd, char* data, size_t size, uint64_t offset) {
+            size_t total = 0;
+            while (total < size) {
+                ssize_t n = ::pread(fd, data + total, size - total, static_cast<off_t>(offset + total));
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error("pread failed | Error: " + std::string(std::strerror(errno)));
+                }
+                if (n == 0) {
+                    break;
+                }
+                total += static_cast<size_t>(n);
+            }
+            return total;
+        }
+    }
+
+    Tablespace::Tablespace(const std::string& db_file, const TablespaceOptions& options)
+        : segment_pages_(options.segment_pages), extend_pages_(std::max<PageId>(options.extend_pages, 1)),
+          read_only_(options.read_only) {
+        if (segment_pages_ == 0) {
+            throw std::runtime_error("Tablespace segment size must be at least one page");
+        }
+
+        std::vector<std::string> paths = {db_file};
+        paths.insert(paths.end(), options.extra_files.begin(), options.extra_files.end());
+
+        // 다른 파일 구성으로 만든 DB를 열면 페이지 위치가 전부 어긋나므로, 파일을 열기 전에 확인
+        files_.resize(paths.size());
+        for (size_t i = 0; i < paths.size(); i++) {
+            files_[i].path_ = paths[i];
+        }
+        CheckDescriptor(std::filesystem::path(db_file).replace_extension(".tbs").string());
+
+        for (auto& file : files_) {
+            // 읽기 전용이면 없는 파일은 open이 ENOENT로 실패함 (새로 만들지 않음)
+            bool exists = std::filesystem::exists(file.path_);
+            file.fd_ = ::open(file.path_.c_str(), read_only_ ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+            if (file.fd_ < 0) {
+                int err = errno;
+                Close();
+                throw std::runtime_error("Failed to open file: " + file.path_ + " | Error: " + std::strerror(err));
+            }
+            file.metrics_ = std::make_unique<DataFileMetrics>();
+            if (!exists) {
+                spdlog::info("Created new database file: {}", file.path_);
+            }
+        }
+
+        PageId num_pages = ComputeNumPages();
+        num_pages_.store(num_pages, std::memory_order_release);
+        extent_pages_.store(num_pages, std::memory_order_release);
+    }
+
+    Tablespace::~Tablespace() {
+        Close();
+    }
+
+    void Tablespace::Close() {
+        for (auto& file : files_) {
+            if (file.fd_ >= 0) {
+                ::close(file.fd_);
+                file.fd_ = -1;
+            }
+        }
+    }
+
+    void Tablespace::CheckDescriptor(const std::string& descriptor_path) {
+        std::ostringstream expected;
+        expected << "segment_pages " << segment_pages_ << "\n";
+        for (const auto& file : files_) {
+            expected << "file " << file.path_ << "\n";
+        }
+
+        std::ifstream in(descriptor_path);
+        if (in.is_open()) {
+            std::stringstream actual;
+            actual << in.rdbuf();
+            if (actual.str() != expected.str()) {
+                throw std::runtime_error("Tablespace layout does not match " + descriptor_path +
+                                         " (data files and segment size must be the same as when it was created)");
+            }
+            return;
+        }
+
+        // 파일 하나짜리는 기존 DB 파일과 같은 배치이므로 기록하지 않음
+        if (files_.size() == 1 || read_only_) {
+            return;
+        }
+
+        std::ofstream out(descriptor_path, std::ios::trunc);
+        out << expected.str();
+        if (!out.good()) {
+            throw std::runtime_error("Failed to write tablespace descriptor: " + descriptor_path);
+        }
+    }
+
+    PageId Tablespace::ComputeNumPages() {
+        PageId num_pages = 0;
+        for (size_t i = 0; i < files_.size(); i++) {
+            off_t size = ::lseek(files_[i].fd_, 0, SEEK_END);
+            if (size < 0) {
+                throw std::runtime_error("Failed to get size of " + files_[i].path_ +
+                                         " | Error: " + std::strerror(errno));
+            }
+            auto local_pages = static_cast<PageId>(static_cast<uint64_t>(size) / PAGE_SIZE);
+            files_[i].size_pages_ = local_pages;
+            if (local_pages == 0) {
+                continue;
+            }
+
+            // 이 파일의 마지막 페이지를 전역 ID로 되돌림
+            PageId last = local_pages - 1;
+            PageId segment = (last / segment_pages_) * files_.size() + i;
+            num_pages = std::max(num_pages, segment * segment_pages_ + last % segment_pages_ + 1);
+        }
+        return num_pages;
+    }
+
+    void Tablespace::ReadPage(PageId page_id, char* data) {
+        if (page_id >= GetNumPages() || page_id >= get_extent_pages()) {
+            throw std::runtime_error("ReadPage: PageId out of bound");
+        }
+
+        Location location = Locate(page_id);
+        DataFile& file = files_[location.file_index];
+        file.metrics_->pages_read.Add();
+
+        if (PreadFull(file.fd_, data, PAGE_SIZE, location.offset) != PAGE_SIZE) {
+            spdlog::error("I/O error while reading page {} (short read from {})", page_id, file.path_);
+        }
+    }
+
+    PageId Tablespace::ReadPages(PageId first, PageId count, char* data) {
+        PageId num_pages = std::min(GetNumPages(), get_extent_pages());
+        if (first >= num_pages) {
+            return 0;
+        }
+        count = std::min(count, num_pages - first);
+
+        // 세그먼트 안에서는 파일에서도 연속이므로, 세그먼트 경계마다 pread 한 번
+        PageId done = 0;
+        while (done < count) {
+            PageId page_id = first + done;
+            PageId run = std::min(count - done, segment_pages_ - page_id % segment_pages_);
+
+            Location location = Locate(page_id);
+            DataFile& file = files_[location.file_index];
+            size_t bytes = static_cast<size_t>(run) * PAGE_SIZE;
+            if (PreadFull(file.fd_, data + static_cast<size_t>(done) * PAGE_SIZE, bytes, location.offset) != bytes) {
+                spdlog::error("I/O error while reading pages [{}, {}) (short read from {})",
+                              page_id, page_id + run, file.path_);
+                return done;
+            }
+            file.metrics_->pages_read.Add(run);
+            done += run;
+        }
+        return done;
+    }
+
+    void Tablespace::WritePage(PageId page_id, const char* data, uint32_t checksum) {
+        Location location = Locate(page_id);
+        DataFile& file = files_[location.file_index];
+        file.metrics_->pages_written.Add();
+
+        iovec iov[2];
+        iov[0].iov_base = const_cast<char*>(data);
+        iov[0].iov_len = PAGE_CHECKSUM_OFFSET;
+        iov[1].iov_base = &checksum;
+        iov[1].iov_len = sizeof(checksum);
+
+        // 16KB 일반 파일 쓰기는 사실상 한 번에 끝나지만, 일부만 썼으면 남은 부분을 이어서 씀
+        size_t written = 0;
+        while (written < PAGE_SIZE) {
+            ssize_t n;
+            if (written == 0) {
+                n = ::pwritev(file.fd_, iov, 2, static_cast<off_t>(location.offset));
+            } else {
+                char page[PAGE_SIZE];
+                std::memcpy(page, data, PAGE_CHECKSUM_OFFSET);
+                std::memcpy(page + PAGE_CHECKSUM_OFFSET, &checksum, sizeof(checksum));
+                n = ::pwrite(file.fd_, page + written, PAGE_SIZE - written,
+                             static_cast<off_t>(location.offset + written));
+            }
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::runtime_error("WritePage failed on " + file.path_ +
+                                         " | Error: " + std::string(std::strerror(errno)));
+            }
+            written += static_cast<size_t>(n);
+        }
+    }
+
+    PageId Tablespace::AllocatePage() {
+        PageId page_id = num_pages_.fetch_add(1, std::memory_order_acq_rel);
+        if (page_id < extent_pages_.load(std::memory_order_acquire)) {
+            return page_id;
+        }
+
+        // 파일 끝을 넘음: 한 스레드만 늘리고, 그동안 같은 구간을 받은 스레드는 기다렸다가 바로 반환
+        std::scoped_lock lock(extend_mutex_);
+        PageId extent = extent_pages_.load(std::memory_order_relaxed);
+        if (page_id >= extent) {
+            PageId target = (page_id / extend_pages_ + 1) * extend_pages_;
+            ExtendTo(target);
+            extent_pages_.store(target, std::memory_order_release);
+        }
+        return page_id;
+    }
+
+    PageId Tablespace::LocalPages(PageId num_pages, size_t file_index) const {
+        // [0, num_pages) 중 이 파일에 있는 페이지 수 = 꽉 찬 세그먼트 중 이 파일 몫 + 마지막 세그먼트의 일부
+        PageId full_segments = num_pages / segment_pages_;
+        PageId remainder = num_pages % segment_pages_;
+        size_t n = files_.size();
+
+        PageId local_pages = (full_segments / n + (file_index < full_segments % n ? 1 : 0)) * segment_pages_;
+        if (remainder > 0 && full_segments % n == file_index) {
+            local_pages += remainder;
+        }
+        return local_pages;
+    }
+
+    void Tablespace::ExtendTo(PageId num_pages) {
+        for (size_t f = 0; f < files_.size(); f++) {
+            DataFile& file = files_[f];
+            PageId local_pages = LocalPages(num_pages, f);
+            if (local_pages <= file.size_pages_) {
+                continue;
+            }
+
+            // 늘어난 부분은 0으로 읽힘 (= 한 번도 안 쓴 페이지)
+            if (::ftruncate(file.fd_, static_cast<off_t>(local_pages * PAGE_SIZE)) != 0) {
+                throw std::runtime_error("Failed to extend " + file.path_ +
+                                         " | Error: " + std::string(std::strerror(errno)));
+            }
+            file.size_pages_ = local_pages;
+        }
+    }
+
+    void Tablespace::TrimToNumPages() {
+        std::scoped_lock lock(extend_mutex_);
+        PageId num_pages = GetNumPages();
+        for (size_t f = 0; f < files_.size(); f++) {
+            DataFile& file = files_[f];
+            PageId local_pages = LocalPages(num_pages, f);
+            if (file.fd_ < 0 || local_pages >= file.size_pages_) {
+                continue;
+            }
+            if (::ftruncate(file.fd_, static_cast<off_t>(local_pages * PAGE_SIZE)) != 0) {
+                throw std::runtime_error("Failed to trim " + file.path_ +
+                                         " | Error: " + std::string(std::strerror(errno)));
+            }
+            file.size_pages_ = local_pages;
+        }
+        extent_pages_.store(num_pages, std::memory_order_release);
+    }
+
+    void Tablespace::RestoreNumPages(PageId num_pages) {
+        std::scoped_lock lock(extend_mutex_);
+        if (num_pages <= extent_pages_.load(std::memory_order_relaxed)) {
+            num_pages_.store(num_pages, std::memory_order_release);
+        }
+    }
+
+    void Tablespace::GrowNumPages(PageId num_pages) {
+        std::scoped_lock lock(extend_mutex_);
+        if (num_pages <= num_pages_.load(std::memory_order_acquire)) {
+            return;
+        }
+        if (num_pages > extent_pages_.load(std::memory_order_relaxed)) {
+            ExtendTo(num_pages);
+            extent_pages_.store(num_pages, std::memory_order_release);
+        }
+        num_pages_.store(num_pages, std::memory_order_release);
+    }
+
+    void Tablespace::Sync() {
+        for (const auto& file : files_) {
+            if (file.fd_ >= 0 && ::fdatasync(file.fd_) != 0) {
+                throw std::runtime_error("Sync failed on " + file.path_ +
+                                         " | Error: " + std::string(std::strerror(errno)));
+            }
+        }
+    }
+}
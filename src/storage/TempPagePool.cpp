@@ -0,0 +1,181 @@
+#include "mydb/storage/TempPagePool.hpp"
+
+#include <spdlog/spdlog.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>  // open
+#include <unistd.h> // write, fdatasync
+
+#include "mydb/common/Crc32c.hpp"
+
+namespace mydb {
+
+    namespace {
+        // spill 파일: [count 4][crc32c 4][PageId x count] 묶음의 반복 (Reserve 한 번 = 묶음 하나)
+        constexpr size_t SPILL_BATCH_HEADER_SIZE = sizeof(uint32_t) * 2;
+    }
+
+    TempPagePool::TempPagePool(PageAllocator* allocator, std::string spill_path, bool read_only)
+        : allocator_(allocator), spill_path_(std::move(spill_path)) {
+        if (!read_only) {
+            Reclaim();
+        }
+    }
+
+    TempPagePool::~TempPagePool() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    PageId TempPagePool::Allocate() {
+        std::scoped_lock lock(mutex_);
+        if (free_.empty()) {
+            Reserve();
+        }
+        PageId page_id = free_.back();
+        free_.pop_back();
+        pages_[page_id] = true;
+        return page_id;
+    }
+
+    bool TempPagePool::Free(PageId page_id) {
+        std::scoped_lock lock(mutex_);
+        auto iter = pages_.find(page_id);
+        if (iter == pages_.end() || !iter->second) {
+            spdlog::warn("TempPagePool: ignoring free of page {} (not an allocated temporary page)", page_id);
+            return false;
+        }
+        iter->second = false;
+        free_.push_back(page_id);
+        return true;
+    }
+
+    bool TempPagePool::IsTempPage(PageId page_id) const {
+        std::scoped_lock lock(mutex_);
+        return pages_.find(page_id) != pages_.end();
+    }
+
+    size_t TempPagePool::GetNumPages() const {
+        std::scoped_lock lock(mutex_);
+        return pages_.size();
+    }
+
+    size_t TempPagePool::GetNumFreePages() const {
+        std::scoped_lock lock(mutex_);
+        return free_.size();
+    }
+
+    void TempPagePool::Reserve() {
+        std::vector<PageId> reserved;
+        reserved.reserve(TEMP_RESERVE_PAGES);
+        for (size_t i = 0; i < TEMP_RESERVE_PAGES; i++) {
+            reserved.push_back(allocator_->Allocate());
+        }
+
+        // 내주기 전에 기록: 크래시 후에 .spill에 없는 임시 페이지가 남지 않게
+        std::vector<char> batch(SPILL_BATCH_HEADER_SIZE + reserved.size() * sizeof(PageId));
+        auto count = static_cast<uint32_t>(reserved.size());
+        uint32_t crc = Crc32c(reserved.data(), reserved.size() * sizeof(PageId));
+        std::memcpy(batch.data(), &count, sizeof(count));
+        std::memcpy(batch.data() + sizeof(count), &crc, sizeof(crc));
+        std::memcpy(batch.data() + SPILL_BATCH_HEADER_SIZE, reserved.data(), reserved.size() * sizeof(PageId));
+
+        try {
+            if (fd_ < 0) {
+                fd_ = ::open(spill_path_.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+                if (fd_ < 0) {
+                    throw std::runtime_error("Failed to open spill page file: " + spill_path_ +
+                                             " | Error: " + std::strerror(errno));
+                }
+            }
+
+            size_t written = 0;
+            while (written < batch.size()) {
+                ssize_t n = ::write(fd_, batch.data() + written, batch.size() - written);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error("Failed to write spill page file: " + spill_path_ +
+                                             " | Error: " + std::strerror(errno));
+                }
+                written += static_cast<size_t>(n);
+            }
+            if (::fdatasync(fd_) != 0) {
+                throw std::runtime_error("Failed to sync spill page file: " + spill_path_ +
+                                         " | Error: " + std::strerror(errno));
+            }
+        } catch (...) {
+            // 기록되지 않은 ID는 임시 페이지로 내주지 않고 바로 돌려줌
+            for (PageId page_id : reserved) {
+                allocator_->Free(page_id);
+            }
+            throw;
+        }
+
+        for (PageId page_id : reserved) {
+            pages_[page_id] = false;
+            free_.push_back(page_id);
+        }
+    }
+
+    void TempPagePool::Release() {
+        std::scoped_lock lock(mutex_);
+        for (const auto& [page_id, in_use] : pages_) {
+            allocator_->Free(page_id);
+        }
+        pages_.clear();
+        free_.clear();
+
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        std::filesystem::remove(spill_path_);
+    }
+
+    void TempPagePool::Reclaim() {
+        std::ifstream in(spill_path_, std::ios::binary);
+        if (!in.is_open()) {
+            return;
+        }
+
+        // 마지막 묶음은 쓰다가 끊겼을 수 있음: 길이나 체크섬이 맞지 않는 묶음부터는 버림 (그 묶음의 ID는 내준 적 없음)
+        std::vector<PageId> pages;
+        while (true) {
+            char header[SPILL_BATCH_HEADER_SIZE];
+            if (!in.read(header, sizeof(header))) {
+                break;
+            }
+            uint32_t count;
+            uint32_t crc;
+            std::memcpy(&count, header, sizeof(count));
+            std::memcpy(&crc, header + sizeof(count), sizeof(crc));
+            if (count == 0 || count > TEMP_RESERVE_PAGES) {
+                break;
+            }
+
+            std::vector<PageId> batch(count);
+            if (!in.read(reinterpret_cast<char*>(batch.data()), static_cast<std::streamsize>(count * sizeof(PageId))) ||
+                Crc32c(batch.data(), batch.size() * sizeof(PageId)) != crc) {
+                break;
+            }
+            pages.insert(pages.end(), batch.begin(), batch.end());
+        }
+        in.close();
+
+        for (PageId page_id : pages) {
+            if (allocator_->Free(page_id)) {
+                num_reclaimed_++;
+            }
+        }
+        std::filesystem::remove(spill_path_);
+
+        spdlog::info("TempPagePool: reclaimed {} temporary pages left by a crash ({})", num_reclaimed_, spill_path_);
+    }
+}
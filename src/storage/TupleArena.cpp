@@ -0,0 +1,33 @@
+#include "mydb/storage/TupleArena.hpp"
+
+#include <algorithm>
+
+namespace mydb {
+
+    TupleArena::TupleArena(size_t block_size) : block_size_(std::max(block_size, ALIGNMENT)) {}
+
+    char* TupleArena::AllocateSlow(size_t size) {
+        bytes_used_ += size;
+
+        if (size > block_size_ / 4) {
+            large_blocks_.push_back(std::make_unique_for_overwrite<char[]>(size));
+            return large_blocks_.back().get();
+        }
+
+        if (next_block_ == blocks_.size()) {
+            blocks_.push_back(std::make_unique_for_overwrite<char[]>(block_size_));
+        }
+        char* block = blocks_[next_block_++].get();
+        cursor_ = block + size;
+        end_ = block + block_size_;
+        return block;
+    }
+
+    void TupleArena::Reset() {
+        next_block_ = 0;
+        cursor_ = nullptr;
+        end_ = nullptr;
+        bytes_used_ = 0;
+        large_blocks_.clear();
+    }
+}
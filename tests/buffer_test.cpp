@@ -1,10 +1,16 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
 #include <filesystem>
+#include <fstream>
 #include <string>
 #include <random>
 
 #include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/buffer/BufferPoolWarmer.hpp"
+#include "mydb/buffer/ClockReplacer.hpp"
 #include "mydb/buffer/LRUReplacer.hpp"
+#include "mydb/buffer/ReplacementSimulator.hpp"
 
 namespace mydb {
 
@@ -41,6 +47,118 @@ namespace mydb {
         EXPECT_FALSE(lru.Victim(&victim));
     }
 
+    // CLOCK: 참조 비트가 켜진 프레임은 한 번 건너뜀 (second chance)
+    TEST(BufferPoolTest, ClockReplacerTest) {
+        ClockReplacer clock(3);
+
+        FrameId victim;
+        EXPECT_EQ(clock.Size(), 0);
+        EXPECT_FALSE(clock.Victim(&victim));
+
+        clock.Unpin(0);
+        clock.Unpin(1);
+        clock.Unpin(2);
+        EXPECT_EQ(clock.Size(), 3);
+
+        clock.Pin(1);
+        EXPECT_EQ(clock.Size(), 2);
+
+        // 첫 바퀴에서 0, 2의 참조 비트를 끄고, 두 번째로 만난 0이 victim
+        EXPECT_TRUE(clock.Victim(&victim));
+        EXPECT_EQ(victim, 0);
+
+        // 바늘은 1에 있음: 1은 방금 unpin돼서 한 번 건너뛰고, 참조 비트가 꺼진 2가 victim
+        clock.Unpin(1);
+        EXPECT_TRUE(clock.Victim(&victim));
+        EXPECT_EQ(victim, 2);
+
+        EXPECT_TRUE(clock.Victim(&victim));
+        EXPECT_EQ(victim, 1);
+        EXPECT_FALSE(clock.Victim(&victim));
+    }
+
+    // 트레이스를 같은 정책/풀 크기로 재생하면 실제 버퍼 풀과 hit/miss/eviction이 정확히 같아야 함
+    TEST(BufferPoolTest, AccessTraceReplayTest) {
+        const std::string db_name = "trace_test.db";
+        const std::string trace_name = "trace_test.trc";
+
+        for (ReplacerType policy : {ReplacerType::LRU, ReplacerType::CLOCK}) {
+            std::filesystem::remove(db_name);
+            std::filesystem::remove("trace_test.fsm");
+
+            constexpr size_t kPoolSize = 8;
+            constexpr PageId kNumPages = 32;
+
+            DiskManager disk_manager(db_name);
+            BufferPoolOptions options;
+            options.replacer = policy;
+            BufferPoolManager bpm(kPoolSize, &disk_manager, nullptr, options);
+            bpm.StartTrace(trace_name);
+
+            for (PageId i = 0; i < kNumPages; i++) {
+                PageId page_id;
+                ASSERT_NE(bpm.NewPage(&page_id), nullptr);
+                bpm.UnpinPage(page_id, true);
+            }
+
+            // 앞쪽 페이지에 몰린 접근 + 가끔 두 페이지를 동시에 잡음
+            std::mt19937 rng(7);
+            std::uniform_int_distribution<PageId> hot(0, 5);
+            std::uniform_int_distribution<PageId> any(0, kNumPages - 1);
+            for (int i = 0; i < 2000; i++) {
+                PageId page_id = (rng() % 4 == 0) ? any(rng) : hot(rng);
+                ASSERT_NE(bpm.FetchPage(page_id), nullptr);
+                if (i % 7 == 0) {
+                    PageId other = any(rng);
+                    ASSERT_NE(bpm.FetchPage(other), nullptr);
+                    bpm.UnpinPage(other, false);
+                }
+                bpm.UnpinPage(page_id, i % 3 == 0);
+            }
+
+            // 만들자마자 지우는 페이지: 지운 프레임이 free list로 돌아가고 반납된 ID가 다음 NewPage에서 재사용됨
+            for (int i = 0; i < 20; i++) {
+                PageId page_id;
+                ASSERT_NE(bpm.NewPage(&page_id), nullptr);
+                bpm.UnpinPage(page_id, true);
+                ASSERT_TRUE(bpm.DeletePage(page_id));
+                PageId hot_page = hot(rng);
+                ASSERT_NE(bpm.FetchPage(hot_page), nullptr);
+                bpm.UnpinPage(hot_page, false);
+            }
+
+            BufferPoolMetricsSnapshot metrics = bpm.GetMetricsSnapshot();
+            EXPECT_GT(bpm.StopTrace(), 0u);
+            EXPECT_EQ(bpm.StopTrace(), 0u);
+
+            auto results = ReplacementSimulator::Replay(trace_name, {policy}, {kPoolSize});
+            ASSERT_EQ(results.size(), 1u);
+            const SimulationResult& result = results[0];
+            EXPECT_EQ(result.hits, metrics.fetch_hits) << ReplacerTypeName(policy);
+            EXPECT_EQ(result.misses, metrics.fetch_misses) << ReplacerTypeName(policy);
+            EXPECT_EQ(result.new_pages, metrics.new_pages) << ReplacerTypeName(policy);
+            EXPECT_EQ(result.evictions, metrics.evictions) << ReplacerTypeName(policy);
+            EXPECT_EQ(result.dirty_writebacks, metrics.dirty_writebacks) << ReplacerTypeName(policy);
+            EXPECT_EQ(result.stalls, 0u);
+
+            // 풀이 모든 페이지(+ 만들고 지우는 페이지 하나)를 담을 수 있으면 cold miss만 남음 (NewPage로 올렸던 페이지라 miss 없음)
+            auto full = ReplacementSimulator::Replay(trace_name, {policy}, {kNumPages + 1});
+            EXPECT_EQ(full[0].misses, 0u);
+            EXPECT_EQ(full[0].evictions, 0u);
+
+            // 헤더가 깨진 파일은 거부
+            {
+                std::fstream file(trace_name, std::ios::binary | std::ios::in | std::ios::out);
+                file.put('X');
+            }
+            EXPECT_THROW(TraceReader reader(trace_name), std::runtime_error);
+        }
+
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("trace_test.fsm");
+        std::filesystem::remove(trace_name);
+    }
+
     // BufferPoolManager 부분 전체 테스트(페이지 생성, 데이터 쓰기, 쫓아내기, 다시 불러오기
     TEST(BufferPoolTest, BufferPoolIntegrationTest) {
         const std::string db_name = "test.db";
@@ -99,4 +217,510 @@ namespace mydb {
         disk_manager.ShutDown();
         std::filesystem::remove(db_name);
     }
-}
\ No newline at end of file
+
+    // 프레임 메모리: huge page/NUMA 요청이 안 되는 환경에서도 일반 페이지로 대체되어 동작해야 함
+    TEST(BufferPoolTest, FrameArenaTest) {
+        FrameArenaOptions options;
+        options.use_huge_pages = true;
+        options.numa_policy = NumaPolicy::INTERLEAVE;
+
+        FrameArena arena(3 * PAGE_SIZE, options);
+        ASSERT_NE(arena.get_data(), nullptr);
+        EXPECT_EQ(arena.get_size(), 3 * PAGE_SIZE);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(arena.get_data()) % PAGE_SIZE, 0);
+
+        // 처음 접근하는 메모리는 커널이 0으로 채워줌
+        for (size_t i = 0; i < arena.get_size(); i += 4096) {
+            EXPECT_EQ(arena.get_data()[i], 0);
+        }
+
+        // 존재하지 않는 노드에 BIND하면 정책만 무시되고 할당은 성공
+        options.numa_policy = NumaPolicy::BIND;
+        options.numa_node = 63;
+        FrameArena unbound(PAGE_SIZE, options);
+        EXPECT_FALSE(unbound.is_numa_applied());
+
+        // 버퍼 풀 프레임으로 사용: 새 페이지는 자기 ID를 알고, 쫓겨났다 다시 올라와도 유지
+        const std::string db_name = "frame_arena_test.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolOptions pool_options;
+            pool_options.arena = options;
+            BufferPoolManager bpm(2, &disk_manager, nullptr, pool_options);
+
+            PageId page_ids[3];
+            for (auto& page_id : page_ids) {
+                Page* page = bpm.NewPage(&page_id);
+                ASSERT_NE(page, nullptr);
+                EXPECT_EQ(page->get_page_id(), page_id);
+                std::memcpy(page->get_data(), &page_id, sizeof(page_id));
+                bpm.UnpinPage(page_id, true);
+            }
+
+            Page* page = bpm.FetchPage(page_ids[0]);
+            ASSERT_NE(page, nullptr);
+            EXPECT_EQ(page->get_page_id(), page_ids[0]);
+            EXPECT_EQ(std::memcmp(page->get_data(), &page_ids[0], sizeof(PageId)), 0);
+            bpm.UnpinPage(page_ids[0], false);
+        }
+        std::filesystem::remove(db_name);
+    }
+
+    // 읽기 전용 mmap 모드: 디스크 내용을 복사 없이 보여주고, 쓰기 작업은 거부, 손상된 페이지는 처음 접근할 때 감지
+    TEST(BufferPoolTest, MmapReadOnlyTest) {
+        const std::string db_name = "mmap_test.db";
+        std::filesystem::remove(db_name);
+
+        constexpr int kNumPages = 10;
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(3, &disk_manager);
+            for (int i = 0; i < kNumPages; i++) {
+                PageId page_id;
+                Page* page = bpm.NewPage(&page_id);
+                ASSERT_NE(page, nullptr);
+                std::snprintf(page->get_data(), 32, "page %d", i);
+                bpm.UnpinPage(page_id, true);
+            }
+            bpm.FlushAllPages();
+        }
+
+        // 마지막 페이지를 손상시킴
+        {
+            std::fstream file(db_name, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(static_cast<std::streamoff>(kNumPages - 1) * PAGE_SIZE + 100);
+            file.put('X');
+        }
+
+        // 쓰는 쪽으로 열린 DiskManager와는 같이 쓸 수 없음
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolOptions options;
+            options.mmap_read_only = true;
+            EXPECT_THROW(BufferPoolManager(1, &disk_manager, nullptr, options), std::runtime_error);
+        }
+
+        TablespaceOptions disk_options;
+        disk_options.read_only = true;
+        DiskManager disk_manager(db_name, disk_options);
+        BufferPoolOptions options;
+        options.mmap_read_only = true;
+        BufferPoolManager bpm(1, &disk_manager, nullptr, options);
+        ASSERT_TRUE(bpm.is_read_only());
+
+        // 프레임 수(1)보다 많은 페이지를 동시에 잡을 수 있음 (교체는 커널이 함)
+        std::vector<Page*> pages;
+        for (int i = 0; i < kNumPages - 1; i++) {
+            Page* page = bpm.FetchPage(i);
+            ASSERT_NE(page, nullptr);
+            EXPECT_EQ(page->get_data(), disk_manager.GetMappedPage(i));
+            EXPECT_EQ(page->get_page_id(), static_cast<PageId>(i));
+            EXPECT_EQ(std::string(page->get_data()), "page " + std::to_string(i));
+            pages.push_back(page);
+        }
+        for (int i = 0; i < kNumPages - 1; i++) {
+            EXPECT_TRUE(bpm.UnpinPage(i, false));
+        }
+
+        EXPECT_THROW(bpm.FetchPage(kNumPages - 1), PageCorruptionError);
+        EXPECT_EQ(bpm.FetchPage(kNumPages), nullptr);
+
+        // 쓰기 작업은 모두 실패
+        PageId page_id;
+        EXPECT_EQ(bpm.NewPage(&page_id), nullptr);
+        EXPECT_FALSE(bpm.UnpinPage(0, true));
+        EXPECT_FALSE(bpm.FlushPage(0));
+
+        bpm.AdviseAccess(AccessPattern::SEQUENTIAL);
+        EXPECT_NE(bpm.FetchPage(0), nullptr);
+
+        disk_manager.ShutDown();
+        std::filesystem::remove(db_name);
+    }
+
+    // 재시작 전 상주 페이지를 스냅샷으로 남기고, 재시작 후 백그라운드로 다시 올림
+    TEST(BufferPoolTest, WarmRestartTest) {
+        const std::string db_name = "warm_test.db";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("warm_test.warm");
+
+        constexpr PageId kNumPages = 64;
+        constexpr size_t kPoolSize = 16;
+        std::string snapshot_path;
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(kPoolSize, &disk_manager);
+            for (PageId i = 0; i < kNumPages; i++) {
+                PageId page_id;
+                Page* page = bpm.NewPage(&page_id);
+                ASSERT_NE(page, nullptr);
+                std::snprintf(page->get_data(), 32, "page %lu", static_cast<unsigned long>(page_id));
+                bpm.UnpinPage(page_id, true);
+            }
+
+            // 핫셋 = 20 ~ 35. 35가 가장 최근
+            for (PageId i = 20; i < 36; i++) {
+                ASSERT_NE(bpm.FetchPage(i), nullptr);
+                bpm.UnpinPage(i, false);
+            }
+
+            BufferPoolWarmer warmer(&bpm, &disk_manager);
+            snapshot_path = warmer.get_snapshot_path();
+            EXPECT_EQ(warmer.SaveSnapshot(), kPoolSize);
+            bpm.FlushAllPages();
+        }
+
+        std::vector<PageId> snapshot = BufferPoolWarmer::LoadSnapshot(snapshot_path);
+        ASSERT_EQ(snapshot.size(), kPoolSize);
+        EXPECT_EQ(snapshot.front(), 35u);
+        EXPECT_EQ(snapshot.back(), 20u);
+
+        // 1. 같은 크기의 풀: 핫셋 전체가 올라와서 첫 요청부터 hit
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(kPoolSize, &disk_manager);
+            BufferPoolWarmer warmer(&bpm, &disk_manager);
+            warmer.StartWarmup();
+            WarmupStats stats = warmer.WaitForWarmup();
+
+            EXPECT_TRUE(stats.done);
+            EXPECT_EQ(stats.snapshot_pages, kPoolSize);
+            EXPECT_EQ(stats.loaded_pages, kPoolSize);
+            EXPECT_EQ(stats.batches, 1u); // 연속 구간 하나
+
+            for (PageId i = 20; i < 36; i++) {
+                Page* page = bpm.FetchPage(i);
+                ASSERT_NE(page, nullptr);
+                EXPECT_EQ(std::string(page->get_data()), "page " + std::to_string(i));
+                bpm.UnpinPage(i, false);
+            }
+            BufferPoolMetricsSnapshot metrics = bpm.GetMetricsSnapshot();
+            EXPECT_EQ(metrics.fetch_misses, 0u);
+            EXPECT_EQ(metrics.prewarmed_pages, kPoolSize);
+            EXPECT_EQ(metrics.prewarm_hits, kPoolSize);
+        }
+
+        // 2. 더 작은 풀 + 트래픽이 먼저 올린 페이지: 최근 순서로 남은 자리만 채우고, 이미 있는 페이지는 건너뜀
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(8, &disk_manager);
+            ASSERT_NE(bpm.FetchPage(35), nullptr);
+            bpm.UnpinPage(35, false);
+
+            WarmupOptions options;
+            options.max_batch_pages = 4;
+            BufferPoolWarmer warmer(&bpm, &disk_manager, options);
+            warmer.StartWarmup();
+            WarmupStats stats = warmer.WaitForWarmup();
+
+            EXPECT_EQ(stats.snapshot_pages, 8u);
+            EXPECT_EQ(stats.loaded_pages, 7u);
+            EXPECT_EQ(stats.skipped_pages, 1u);
+            EXPECT_EQ(stats.batches, 2u);
+
+            std::vector<PageId> resident = bpm.GetResidentPages();
+            std::sort(resident.begin(), resident.end());
+            EXPECT_EQ(resident, (std::vector<PageId>{28, 29, 30, 31, 32, 33, 34, 35}));
+        }
+
+        // 3. 깨진 스냅샷은 무시 (재시작을 막지 않음)
+        {
+            std::fstream file(snapshot_path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(-1, std::ios::end);
+            file.put('X');
+        }
+        EXPECT_TRUE(BufferPoolWarmer::LoadSnapshot(snapshot_path).empty());
+
+        std::filesystem::remove(db_name);
+        std::filesystem::remove(snapshot_path);
+    }
+
+    // DeletePage: pin된 페이지는 거부, 지운 페이지의 프레임과 ID는 재사용
+    TEST(BufferPoolTest, DeletePageTest) {
+        const std::string db_name = "delete_test.db";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("delete_test.fsm");
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(2, &disk_manager);
+
+            PageId page_id_0;
+            PageId page_id_1;
+            Page* page0 = bpm.NewPage(&page_id_0);
+            ASSERT_NE(page0, nullptr);
+            std::snprintf(page0->get_data(), 32, "old contents");
+            ASSERT_NE(bpm.NewPage(&page_id_1), nullptr);
+
+            // pin 상태면 지울 수 없음
+            EXPECT_FALSE(bpm.DeletePage(page_id_0));
+            bpm.UnpinPage(page_id_0, true);
+            EXPECT_TRUE(bpm.DeletePage(page_id_0));
+            EXPECT_FALSE(bpm.UnpinPage(page_id_0, false)); // 더 이상 메모리에 없음
+
+            // 풀은 꽉 차 있지만(page 1이 pin) 지운 페이지의 프레임이 비었으므로 새 페이지를 만들 수 있고, ID도 재사용됨
+            PageId page_id_2;
+            Page* page2 = bpm.NewPage(&page_id_2);
+            ASSERT_NE(page2, nullptr);
+            EXPECT_EQ(page_id_2, page_id_0);
+            EXPECT_EQ(page2->get_data()[0], 0);
+            EXPECT_EQ(bpm.GetMetricsSnapshot().dirty_writebacks, 0u); // dirty였지만 쓰지 않고 버림
+
+            // 메모리에 없는 페이지도 ID는 반납됨
+            bpm.UnpinPage(page_id_1, false);
+            bpm.UnpinPage(page_id_2, false);
+            PageId page_id_3;
+            ASSERT_NE(bpm.NewPage(&page_id_3), nullptr); // page 1이 쫓겨남
+            bpm.UnpinPage(page_id_3, false);
+            ASSERT_NE(bpm.NewPage(&page_id_3), nullptr);
+            bpm.UnpinPage(page_id_3, false);
+            EXPECT_TRUE(bpm.DeletePage(page_id_1));
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("delete_test.fsm");
+    }
+    // 같은 페이지를 두 번 지우면 두 번째는 거부되고, 이후 NewPage가 같은 ID를 두 번 내주지 않음
+    TEST(BufferPoolTest, DoubleDeletePageTest) {
+        const std::string db_name = "double_delete_test.db";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("double_delete_test.fsm");
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(4, &disk_manager);
+
+            PageId page_id;
+            ASSERT_NE(bpm.NewPage(&page_id), nullptr);
+            bpm.UnpinPage(page_id, true);
+
+            EXPECT_TRUE(bpm.DeletePage(page_id));
+            EXPECT_FALSE(bpm.DeletePage(page_id));
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+
+            // 할당된 적 없는 페이지도 거부
+            EXPECT_FALSE(bpm.DeletePage(disk_manager.GetNumPages() + 10));
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+
+            PageId first;
+            PageId second;
+            ASSERT_NE(bpm.NewPage(&first), nullptr);
+            ASSERT_NE(bpm.NewPage(&second), nullptr);
+            EXPECT_EQ(first, page_id);
+            EXPECT_NE(first, second);
+            bpm.UnpinPage(first, false);
+            bpm.UnpinPage(second, false);
+
+            // 다시 내준 페이지는 free가 아니므로 한 번 더 지울 수 있음
+            EXPECT_TRUE(bpm.DeletePage(first));
+            EXPECT_FALSE(disk_manager.DeallocatePage(first));
+        }
+
+        // 재시작 후에도 free 상태가 복원되어 두 번 반납되지 않음
+        {
+            DiskManager disk_manager(db_name);
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+            EXPECT_TRUE(disk_manager.get_allocator().IsFree(0));
+            EXPECT_FALSE(disk_manager.DeallocatePage(0));
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("double_delete_test.fsm");
+    }
+    // 워밍업이 읽은 뒤 트래픽이 고쳐서 다시 쓴 페이지는 옛 이미지로 올리지 않음
+    TEST(BufferPoolTest, PrewarmSkipsStaleImageTest) {
+        const std::string db_name = "prewarm_stale_test.db";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("prewarm_stale_test.fsm");
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(2, &disk_manager);
+            for (PageId i = 0; i < 3; i++) {
+                PageId page_id;
+                Page* page = bpm.NewPage(&page_id);
+                ASSERT_NE(page, nullptr);
+                std::snprintf(page->get_data(), 32, "old %lu", static_cast<unsigned long>(page_id));
+                bpm.UnpinPage(page_id, true);
+            }
+            bpm.FlushAllPages();
+
+            // 워밍업 쪽: epoch를 받고 디스크에서 페이지 0을 읽음
+            uint64_t read_epoch = bpm.GetPageEpoch();
+            std::vector<char> buffer(PAGE_SIZE);
+            ASSERT_EQ(disk_manager.ReadPages(0, 1, buffer.data()), 1u);
+
+            // 그 사이 트래픽이 페이지 0을 고치고, 쫓겨나면서 디스크에 씀
+            Page* page = bpm.FetchPage(0);
+            ASSERT_NE(page, nullptr);
+            std::snprintf(page->get_data(), 32, "new 0");
+            bpm.UnpinPage(0, true);
+            for (PageId i = 1; i < 3; i++) {
+                ASSERT_NE(bpm.FetchPage(i), nullptr);
+                bpm.UnpinPage(i, false);
+            }
+            ASSERT_TRUE(bpm.DeletePage(2)); // 워밍업이 쓸 빈 프레임
+
+            bool pool_full;
+            EXPECT_EQ(bpm.PrewarmPages(0, 1, buffer.data(), read_epoch, &pool_full), 0u);
+            EXPECT_FALSE(pool_full);
+
+            page = bpm.FetchPage(0);
+            ASSERT_NE(page, nullptr);
+            EXPECT_EQ(std::string(page->get_data()), "new 0");
+            bpm.UnpinPage(0, false);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("prewarm_stale_test.fsm");
+    }
+    // 워밍업으로 올린 페이지는 트래픽이 쓰던 페이지보다 먼저 쫓겨남
+    TEST(BufferPoolTest, PrewarmedPagesEvictedFirstTest) {
+        LRUReplacer lru(3);
+        FrameId victim;
+        lru.Unpin(1);
+        lru.UnpinCold(2);
+        EXPECT_TRUE(lru.Victim(&victim));
+        EXPECT_EQ(victim, 2);
+
+        ClockReplacer clock(3);
+        clock.Unpin(0);
+        clock.UnpinCold(1);
+        EXPECT_TRUE(clock.Victim(&victim));
+        EXPECT_EQ(victim, 1);
+
+        const std::string db_name = "prewarm_cold_test.db";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("prewarm_cold_test.fsm");
+        {
+            DiskManager disk_manager(db_name);
+            {
+                BufferPoolManager bpm(3, &disk_manager);
+                for (PageId i = 0; i < 3; i++) {
+                    PageId page_id;
+                    ASSERT_NE(bpm.NewPage(&page_id), nullptr);
+                    bpm.UnpinPage(page_id, true);
+                }
+                bpm.FlushAllPages();
+            }
+
+            BufferPoolManager bpm(2, &disk_manager);
+            ASSERT_NE(bpm.FetchPage(0), nullptr);
+            bpm.UnpinPage(0, false);
+
+            uint64_t read_epoch = bpm.GetPageEpoch();
+            std::vector<char> buffer(PAGE_SIZE);
+            ASSERT_EQ(disk_manager.ReadPages(1, 1, buffer.data()), 1u);
+            bool pool_full;
+            ASSERT_EQ(bpm.PrewarmPages(1, 1, buffer.data(), read_epoch, &pool_full), 1u);
+
+            // 풀이 꽉 찬 상태에서 새 페이지를 읽으면, 나중에 올라왔어도 워밍업한 1이 victim
+            ASSERT_NE(bpm.FetchPage(2), nullptr);
+            bpm.UnpinPage(2, false);
+            std::vector<PageId> resident = bpm.GetResidentPages();
+            std::sort(resident.begin(), resident.end());
+            EXPECT_EQ(resident, (std::vector<PageId>{0, 2}));
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("prewarm_cold_test.fsm");
+    }
+    // 반납된 ID의 옛 내용이 프레임에 남아 있는 상태에서 NewPage가 그 ID를 다시 내줘도, 한 프레임에만 매핑됨
+    TEST(BufferPoolTest, ReusedPageIdStaleFrameTest) {
+        const std::string db_name = "reuse_stale_test.db";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("reuse_stale_test.fsm");
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(3, &disk_manager);
+            for (PageId i = 0; i < 3; i++) {
+                PageId page_id;
+                Page* page = bpm.NewPage(&page_id);
+                ASSERT_NE(page, nullptr);
+                page->get_data()[0] = 'A';
+                bpm.UnpinPage(page_id, true);
+            }
+            bpm.FlushAllPages();
+
+            // 지운 페이지를 다시 읽어서 옛 내용의 프레임을 남김
+            ASSERT_TRUE(bpm.DeletePage(1));
+            ASSERT_NE(bpm.FetchPage(1), nullptr);
+            bpm.UnpinPage(1, false);
+
+            PageId page_id;
+            Page* page = bpm.NewPage(&page_id);
+            ASSERT_NE(page, nullptr);
+            ASSERT_EQ(page_id, 1u);
+            EXPECT_EQ(page->get_data()[0], 0);
+            page->get_data()[0] = 'Z';
+
+            // pin한 채로 다른 페이지들을 돌려서 나머지 프레임을 모두 쫓아냄
+            for (int i = 0; i < 4; i++) {
+                PageId other;
+                ASSERT_NE(bpm.NewPage(&other), nullptr);
+                bpm.UnpinPage(other, false);
+            }
+            EXPECT_TRUE(bpm.UnpinPage(1, true));
+
+            page = bpm.FetchPage(1);
+            ASSERT_NE(page, nullptr);
+            EXPECT_EQ(page->get_data()[0], 'Z');
+            bpm.UnpinPage(1, false);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("reuse_stale_test.fsm");
+    }
+    // 스냅샷에 있던 페이지가 그 뒤에 반납됐으면 워밍업이 올리지 않음. 임시 페이지는 스냅샷에 넣지 않음
+    TEST(BufferPoolTest, WarmRestartSkipsFreedPagesTest) {
+        const std::string db_name = "warm_freed_test.db";
+        auto cleanup = [] {
+            for (const char* name : {"warm_freed_test.db", "warm_freed_test.fsm", "warm_freed_test.warm"}) {
+                std::filesystem::remove(name);
+            }
+        };
+        cleanup();
+
+        std::string snapshot_path;
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(8, &disk_manager);
+            for (PageId i = 0; i < 4; i++) {
+                PageId page_id;
+                Page* page = bpm.NewPage(&page_id);
+                ASSERT_NE(page, nullptr);
+                page->get_data()[0] = 'A';
+                bpm.UnpinPage(page_id, true);
+            }
+            PageId temp_page_id;
+            ASSERT_NE(bpm.NewTempPage(&temp_page_id), nullptr);
+            bpm.UnpinPage(temp_page_id, true);
+
+            BufferPoolWarmer warmer(&bpm, &disk_manager);
+            snapshot_path = warmer.get_snapshot_path();
+            EXPECT_EQ(warmer.SaveSnapshot(), 4u);
+            ASSERT_TRUE(bpm.DeletePage(1));
+            ASSERT_TRUE(bpm.DeleteTempPage(temp_page_id));
+            bpm.FlushAllPages();
+        }
+
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(8, &disk_manager);
+            ASSERT_TRUE(disk_manager.get_allocator().IsFree(1));
+            BufferPoolWarmer warmer(&bpm, &disk_manager);
+            warmer.StartWarmup();
+            WarmupStats stats = warmer.WaitForWarmup();
+            EXPECT_EQ(stats.snapshot_pages, 4u);
+            EXPECT_EQ(stats.loaded_pages, 3u);
+            EXPECT_EQ(stats.skipped_pages, 1u);
+
+            std::vector<PageId> resident = bpm.GetResidentPages();
+            std::sort(resident.begin(), resident.end());
+            EXPECT_EQ(resident, (std::vector<PageId>{0, 2, 3}));
+
+            // 새 페이지는 반납된 ID 중 하나를 받아도 빈 페이지
+            PageId page_id;
+            Page* page = bpm.NewPage(&page_id);
+            ASSERT_NE(page, nullptr);
+            EXPECT_EQ(page->get_data()[0], 0);
+            bpm.UnpinPage(page_id, false);
+        }
+        cleanup();
+    }
+}
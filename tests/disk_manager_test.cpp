@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/common/Crc32c.hpp"
+#include "mydb/storage/DiskManager.hpp"
+
+namespace mydb {
+
+    // CRC32C 표준 검증값 + 하드웨어/포터블 구현 결과 일치 여부
+    TEST(DiskManagerTest, Crc32cTest) {
+        const char check[] = "123456789";
+        EXPECT_EQ(Crc32cPortable(check, 9), 0xE3069283u);
+        EXPECT_EQ(Crc32c(check, 9), 0xE3069283u);
+
+        // 길이, 정렬이 제각각인 입력에서도 두 구현이 같은 값을 내야 함
+        std::vector<char> buf(PAGE_SIZE + 7);
+        for (size_t i = 0; i < buf.size(); i++) {
+            buf[i] = static_cast<char>(i * 31 + 7);
+        }
+        const std::vector<size_t> offsets = {0, 1, 3};
+        const std::vector<size_t> lengths = {0, 1, 7, 8, 100, PAGE_SIZE};
+        for (size_t offset : offsets) {
+            for (size_t len : lengths) {
+                EXPECT_EQ(Crc32cPortable(buf.data() + offset, len, 42),
+                          Crc32cHardware(buf.data() + offset, len, 42));
+            }
+        }
+
+        // 이어서 계산한 결과 = 한 번에 계산한 결과
+        uint32_t partial = Crc32c(check, 4);
+        EXPECT_EQ(Crc32c(check + 4, 5, partial), 0xE3069283u);
+    }
+
+    // 디스크의 페이지를 일부 망가뜨리면 ReadPage, FetchPage에서 감지되어야 함
+    TEST(DiskManagerTest, ChecksumDetectsCorruptionTest) {
+        const std::string db_name = "checksum_test.db";
+        if (std::filesystem::exists(db_name)) {
+            std::filesystem::remove(db_name);
+        }
+
+        {
+            DiskManager disk_manager(db_name);
+            PageId page_id = disk_manager.AllocatePage();
+
+            // 한 번도 안 쓴(0으로 채워진) 페이지는 정상으로 읽혀야 함
+            Page page;
+            EXPECT_NO_THROW(disk_manager.ReadPage(page_id, page));
+
+            char data[] = "Checksum protected";
+            std::memcpy(page.get_data(), data, sizeof(data));
+            disk_manager.WritePage(page_id, page);
+
+            Page read_page;
+            EXPECT_NO_THROW(disk_manager.ReadPage(page_id, read_page));
+            EXPECT_EQ(std::strcmp(read_page.get_data(), data), 0);
+            EXPECT_EQ(read_page.get_trailer()->checksum_, DiskManager::ComputeChecksum(page_id, page.get_data()));
+
+            // 하위 32비트만 같은 다른 페이지 위치로 잘못 읽힌 경우도 잡아야 함 (PageId 상위 절반도 시드에 포함)
+            EXPECT_THROW(DiskManager::VerifyChecksum(page_id + (PageId{1} << 32), read_page.get_data()),
+                         PageCorruptionError);
+        }
+
+        // 파일을 직접 열어서 데이터 영역의 1바이트를 뒤집음 (비트 손상 흉내)
+        {
+            std::fstream file(db_name, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(3);
+            file.put('X');
+        }
+
+        DiskManager disk_manager(db_name);
+        Page page;
+        EXPECT_THROW(disk_manager.ReadPage(0, page), PageCorruptionError);
+
+        // 버퍼 풀에서도 예외로 알려주고, 프레임은 반납되어야 함
+        BufferPoolManager bpm(1, &disk_manager);
+        EXPECT_THROW(bpm.FetchPage(0), PageCorruptionError);
+
+        PageId new_page_id;
+        Page* new_page = bpm.NewPage(&new_page_id);
+        ASSERT_NE(new_page, nullptr);
+        EXPECT_EQ(new_page_id, 1);
+        bpm.UnpinPage(new_page_id, false);
+
+        disk_manager.ShutDown();
+        std::filesystem::remove(db_name);
+    }
+
+    // 세그먼트 단위로 여러 파일(디렉토리)에 나눠 담고, 다시 열어도 같은 위치에서 읽혀야 함
+    TEST(DiskManagerTest, MultiFileTablespaceTest) {
+        const std::string db_name = "tbs_test.db";
+        const std::vector<std::string> dirs = {"tbs_test_dir1", "tbs_test_dir2"};
+        auto cleanup = [&] {
+            std::filesystem::remove(db_name);
+            std::filesystem::remove("tbs_test.tbs");
+            std::filesystem::remove("tbs_test.fsm");
+            for (const auto& dir : dirs) {
+                std::filesystem::remove_all(dir);
+            }
+        };
+        cleanup();
+        for (const auto& dir : dirs) {
+            std::filesystem::create_directory(dir);
+        }
+
+        TablespaceOptions options;
+        options.extra_files = {dirs[0] + "/tbs_test.1", dirs[1] + "/tbs_test.2"};
+        options.segment_pages = 4;
+        options.extend_pages = 1; // 파일 크기를 할당된 페이지 수와 정확히 맞춰서 배치 확인
+
+        constexpr PageId kNumPages = 30; // 세그먼트 8개 (마지막은 2페이지)
+        {
+            DiskManager disk_manager(db_name, options);
+            const Tablespace& tablespace = disk_manager.get_tablespace();
+            ASSERT_EQ(tablespace.get_num_files(), 3u);
+
+            // 세그먼트 0, 3, 6 -> 파일 0 / 1, 4, 7 -> 파일 1 / 2, 5 -> 파일 2
+            EXPECT_EQ(tablespace.Locate(5).file_index, 1u);
+            EXPECT_EQ(tablespace.Locate(5).offset, 1 * PAGE_SIZE);
+            EXPECT_EQ(tablespace.Locate(13).file_index, 0u);
+            EXPECT_EQ(tablespace.Locate(13).offset, 5 * PAGE_SIZE);
+
+            Page page;
+            for (PageId i = 0; i < kNumPages; i++) {
+                ASSERT_EQ(disk_manager.AllocatePage(), i);
+                std::snprintf(page.get_data(), 32, "page %lu", static_cast<unsigned long>(i));
+                disk_manager.WritePage(i, page);
+            }
+            EXPECT_EQ(disk_manager.GetNumPages(), kNumPages);
+            EXPECT_EQ(tablespace.get_file_metrics(1).pages_written.Load(), 10u);
+        }
+
+        EXPECT_EQ(std::filesystem::file_size(db_name), 12 * PAGE_SIZE);
+        EXPECT_EQ(std::filesystem::file_size(options.extra_files[0]), 10 * PAGE_SIZE);
+        EXPECT_EQ(std::filesystem::file_size(options.extra_files[1]), 8 * PAGE_SIZE);
+
+        {
+            DiskManager disk_manager(db_name, options);
+            EXPECT_EQ(disk_manager.GetNumPages(), kNumPages);
+
+            Page page;
+            for (PageId i = 0; i < kNumPages; i++) {
+                disk_manager.ReadPage(i, page);
+                EXPECT_EQ(std::string(page.get_data()), "page " + std::to_string(i));
+            }
+
+            // 세그먼트 경계를 넘는 일괄 읽기 + 범위 밖은 잘림
+            std::vector<char> buffer(10 * PAGE_SIZE);
+            EXPECT_EQ(disk_manager.ReadPages(22, 10, buffer.data()), 8u);
+            for (PageId i = 0; i < 8; i++) {
+                EXPECT_EQ(std::string(buffer.data() + i * PAGE_SIZE), "page " + std::to_string(22 + i));
+            }
+            EXPECT_THROW(disk_manager.ReadPage(kNumPages, page), std::runtime_error);
+
+            // 읽기 전용 매핑은 파일 하나일 때만
+            EXPECT_THROW(disk_manager.MapFile(), std::runtime_error);
+        }
+
+        // 다른 구성으로 열면 거부 (페이지 위치가 달라지므로)
+        EXPECT_THROW(DiskManager disk_manager(db_name), std::runtime_error);
+        options.segment_pages = 8;
+        EXPECT_THROW(DiskManager disk_manager(db_name, options), std::runtime_error);
+
+        cleanup();
+    }
+
+    // 여러 스레드가 동시에 할당해도 ID가 겹치지 않고, 반납한 ID는 재사용 + 정상 종료 후에도 유지
+    TEST(DiskManagerTest, PageAllocatorTest) {
+        const std::string db_name = "alloc_test.db";
+        const std::string fsm_name = "alloc_test.fsm";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove(fsm_name);
+
+        constexpr int kThreads = 4;
+        constexpr int kPagesPerThread = 500;
+        {
+            DiskManager disk_manager(db_name);
+
+            std::vector<std::vector<PageId>> allocated(kThreads);
+            std::vector<std::thread> threads;
+            for (int t = 0; t < kThreads; t++) {
+                threads.emplace_back([&, t] {
+                    for (int i = 0; i < kPagesPerThread; i++) {
+                        allocated[t].push_back(disk_manager.AllocatePage());
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            std::set<PageId> unique;
+            for (const auto& ids : allocated) {
+                unique.insert(ids.begin(), ids.end());
+            }
+            ASSERT_EQ(unique.size(), static_cast<size_t>(kThreads * kPagesPerThread));
+            EXPECT_EQ(*unique.rbegin(), static_cast<PageId>(kThreads * kPagesPerThread - 1));
+            EXPECT_EQ(disk_manager.GetNumPages(), static_cast<PageId>(kThreads * kPagesPerThread));
+
+            // 파일은 할당된 페이지 수 이상으로 미리 늘어나 있음
+            EXPECT_GE(std::filesystem::file_size(db_name), kThreads * kPagesPerThread * PAGE_SIZE);
+
+            // 반납한 페이지가 high-water mark보다 먼저 쓰임
+            disk_manager.DeallocatePage(7);
+            disk_manager.DeallocatePage(42);
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 2u);
+            std::set<PageId> reused = {disk_manager.AllocatePage(), disk_manager.AllocatePage()};
+            EXPECT_EQ(reused, (std::set<PageId>{7, 42}));
+            EXPECT_EQ(disk_manager.AllocatePage(), static_cast<PageId>(kThreads * kPagesPerThread));
+
+            disk_manager.DeallocatePage(100);
+        }
+
+        // 정상 종료: 미리 늘린 뒷부분은 잘려 있고, free list는 그대로 복원된 뒤 fsm 파일은 지워짐
+        EXPECT_EQ(std::filesystem::file_size(db_name), (kThreads * kPagesPerThread + 1) * PAGE_SIZE);
+        {
+            DiskManager disk_manager(db_name);
+            EXPECT_FALSE(std::filesystem::exists(fsm_name));
+            EXPECT_EQ(disk_manager.GetNumPages(), static_cast<PageId>(kThreads * kPagesPerThread + 1));
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+
+            // 복구용 확장은 free list를 건드리지 않고 high-water mark만 올림
+            PageId num_pages = disk_manager.GetNumPages();
+            disk_manager.ExtendToPage(num_pages + 4);
+            EXPECT_EQ(disk_manager.GetNumPages(), num_pages + 5);
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 1u);
+            disk_manager.ExtendToPage(num_pages); // 이미 있는 페이지면 아무것도 안 함
+            EXPECT_EQ(disk_manager.GetNumPages(), num_pages + 5);
+
+            EXPECT_EQ(disk_manager.AllocatePage(), 100u);
+            EXPECT_EQ(disk_manager.AllocatePage(), num_pages + 5);
+            disk_manager.DeallocatePage(200);
+        }
+
+        // 크래시(fsm 파일 없음): 반납한 페이지는 버려지고, 파일 크기 기준으로 할당을 이어감 (같은 ID를 두 번 내주지 않음)
+        std::filesystem::remove(fsm_name);
+        {
+            DiskManager disk_manager(db_name);
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), 0u);
+            EXPECT_GE(disk_manager.AllocatePage(), static_cast<PageId>(kThreads * kPagesPerThread + 1));
+        }
+
+        std::filesystem::remove(db_name);
+        std::filesystem::remove(fsm_name);
+    }
+    // 읽기 전용으로 열면 파일을 만들거나 바꾸지 않음 (.fsm도 쓰는 쪽이 다음에 열 때를 위해 그대로)
+    TEST(DiskManagerTest, ReadOnlyTest) {
+        const std::string db_name = "read_only_test.db";
+        const std::string fsm_name = "read_only_test.fsm";
+        std::filesystem::remove(db_name);
+        std::filesystem::remove(fsm_name);
+
+        TablespaceOptions read_only;
+        read_only.read_only = true;
+        EXPECT_THROW(DiskManager disk_manager(db_name, read_only), std::runtime_error);
+        EXPECT_FALSE(std::filesystem::exists(db_name));
+
+        Page page;
+        {
+            DiskManager disk_manager(db_name);
+            for (PageId i = 0; i < 3; i++) {
+                ASSERT_EQ(disk_manager.AllocatePage(), i);
+                std::snprintf(page.get_data(), 32, "page %lu", static_cast<unsigned long>(i));
+                disk_manager.WritePage(i, page);
+            }
+            ASSERT_TRUE(disk_manager.DeallocatePage(1));
+        }
+        ASSERT_TRUE(std::filesystem::exists(fsm_name));
+        auto file_size = std::filesystem::file_size(db_name);
+
+        {
+            DiskManager disk_manager(db_name, read_only);
+            EXPECT_TRUE(disk_manager.is_read_only());
+            EXPECT_EQ(disk_manager.GetNumPages(), 3u);
+            disk_manager.ReadPage(2, page);
+            EXPECT_EQ(std::string(page.get_data()), "page 2");
+
+            EXPECT_THROW(disk_manager.AllocatePage(), std::runtime_error);
+            EXPECT_THROW(disk_manager.WritePage(0, page), std::runtime_error);
+            EXPECT_THROW(disk_manager.ExtendToPage(10), std::runtime_error);
+            EXPECT_FALSE(disk_manager.DeallocatePage(2));
+            disk_manager.ShutDown();
+        }
+        EXPECT_EQ(std::filesystem::file_size(db_name), file_size);
+        EXPECT_TRUE(std::filesystem::exists(fsm_name));
+
+        // 쓰는 쪽으로 다시 열면 free list가 그대로 있음
+        {
+            DiskManager disk_manager(db_name);
+            EXPECT_EQ(disk_manager.AllocatePage(), 1u);
+        }
+
+        std::filesystem::remove(db_name);
+        std::filesystem::remove(fsm_name);
+    }
+}
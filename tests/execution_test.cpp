@@ -0,0 +1,438 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mydb/execution/ExternalSort.hpp"
+#include "mydb/execution/HashOperators.hpp"
+#include "mydb/execution/ParallelScan.hpp"
+#include "mydb/execution/TempRun.hpp"
+
+namespace mydb {
+
+    namespace {
+        struct Row {
+            int64_t key;
+            int64_t value;
+        };
+
+        // make_row(i)로 만든 행들을 TablePage 체인으로 적재. 첫 페이지 ID 반환
+        template <typename MakeRow>
+        PageId LoadRows(BufferPoolManager* bpm, size_t num_rows, MakeRow make_row) {
+            PageId first_page_id;
+            auto* page = reinterpret_cast<TablePage*>(bpm->NewPage(&first_page_id));
+            page->Init(first_page_id);
+            PageId page_id = first_page_id;
+
+            for (size_t i = 0; i < num_rows; i++) {
+                auto row = make_row(i);
+                Tuple tuple(reinterpret_cast<const char*>(&row), sizeof(row));
+                uint16_t slot_id;
+                if (page->InsertTuple(tuple, &slot_id)) {
+                    continue;
+                }
+                PageId next_page_id;
+                auto* next = reinterpret_cast<TablePage*>(bpm->NewPage(&next_page_id));
+                next->Init(next_page_id, page_id);
+                page->GetHeader()->next_page_id_ = next_page_id;
+                bpm->UnpinPage(page_id, true);
+                page = next;
+                page_id = next_page_id;
+                page->InsertTuple(tuple, &slot_id);
+            }
+            bpm->UnpinPage(page_id, true);
+            return first_page_id;
+        }
+    }
+
+    // 여러 워커로 나눠 읽어도 모든 페이지를 정확히 한 번씩 방문하고, 워커별 집계를 합친 결과가 직렬 스캔과 같음
+    TEST(ExecutionTest, ParallelScanTest) {
+        const std::string db_name = "scan_test.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(16, &disk_manager);
+
+            constexpr size_t kRows = 20000;
+            PageId first_page_id = LoadRows(&bpm, kRows, [](size_t i) {
+                return Row{static_cast<int64_t>(i % 100), static_cast<int64_t>(i)};
+            });
+            std::vector<PageId> pages = ParallelScan::CollectPages(&bpm, first_page_id);
+            ASSERT_GT(pages.size(), 16u); // 풀보다 큰 테이블
+            EXPECT_EQ(pages.front(), first_page_id);
+
+            ParallelScanOptions options;
+            options.num_threads = 4;
+            options.morsel_pages = 2;
+            ParallelScan scan(&bpm, pages, options);
+
+            std::vector<std::atomic<int>> visits(disk_manager.GetNumPages());
+            ParallelScanStats stats = scan.Run([&](size_t worker, const TablePage* page) {
+                EXPECT_LT(worker, 4u);
+                visits[reinterpret_cast<const PageTrailer*>(page->get_data() + PAGE_TRAILER_OFFSET)->page_id_]++;
+            });
+            EXPECT_EQ(stats.pages_scanned, pages.size());
+            EXPECT_EQ(stats.morsels, (pages.size() + 1) / 2);
+            for (PageId page_id : pages) {
+                EXPECT_EQ(visits[page_id].load(), 1) << "page " << page_id;
+            }
+
+            // SELECT COUNT(*), SUM(value) WHERE key < 10
+            struct Agg {
+                int64_t count = 0;
+                int64_t sum = 0;
+            };
+            Agg agg = scan.Aggregate<Agg>(
+                [](Agg& local, const TablePage* page) {
+                    const Slot* slots = page->GetSlotArray();
+                    for (uint16_t i = 0; i < page->GetHeader()->num_slots_; i++) {
+                        Row row;
+                        std::memcpy(&row, page->get_data() + slots[i].offset_, sizeof(row));
+                        if (row.key < 10) {
+                            local.count++;
+                            local.sum += row.value;
+                        }
+                    }
+                },
+                [](Agg& result, const Agg& local) {
+                    result.count += local.count;
+                    result.sum += local.sum;
+                });
+
+            int64_t expected_count = 0;
+            int64_t expected_sum = 0;
+            for (size_t i = 0; i < kRows; i++) {
+                if (static_cast<int64_t>(i) % 100 < 10) {
+                    expected_count++;
+                    expected_sum += static_cast<int64_t>(i);
+                }
+            }
+            EXPECT_EQ(agg.count, expected_count);
+            EXPECT_EQ(agg.sum, expected_sum);
+
+            // visitor 예외는 Run을 호출한 스레드로 전달되고, pin은 모두 풀려 있음
+            EXPECT_THROW(scan.Run([&](size_t, const TablePage*) { throw std::runtime_error("visitor failed"); }),
+                         std::runtime_error);
+            EXPECT_EQ(scan.Run([](size_t, const TablePage*) {}).pages_scanned, pages.size());
+        }
+        std::filesystem::remove(db_name);
+    }
+
+    // 메모리 한도를 작게 잡아 spill이 일어나도 결과가 std::map으로 계산한 것과 같고, 임시 페이지는 모두 반납됨
+    TEST(ExecutionTest, HashAggregateTest) {
+        const std::string db_name = "hash_agg_test.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(16, &disk_manager);
+
+            constexpr size_t kRows = 30000;
+            auto make_row = [](size_t i) {
+                return Row{static_cast<int64_t>((i * 7919) % 3000), static_cast<int64_t>(i % 1000) - 500};
+            };
+            std::vector<PageId> pages = ParallelScan::CollectPages(&bpm, LoadRows(&bpm, kRows, make_row));
+
+            std::map<int64_t, AggregateRow> expected;
+            for (size_t i = 0; i < kRows; i++) {
+                Row row = make_row(i);
+                auto [it, inserted] = expected.try_emplace(row.key, AggregateRow{row.key, 0, 0, row.value, row.value});
+                it->second.count++;
+                it->second.sum += row.value;
+                it->second.min = std::min(it->second.min, row.value);
+                it->second.max = std::max(it->second.max, row.value);
+            }
+
+            HashOperatorOptions options;
+            options.memory_limit = 32 * 1024; // 2048 entry
+            options.radix_bits = 3;
+            options.partition_table_bytes = 16 * 1024; // 사전 집계는 170개 그룹까지, 나머지는 파티셔닝
+            HashAggregate aggregate(&bpm, options);
+
+            std::map<int64_t, AggregateRow> result;
+            HashOperatorStats stats = aggregate.Execute(pages, KeyValueColumns{}, [&](const AggregateRow& row) {
+                EXPECT_TRUE(result.emplace(row.key, row).second) << "duplicate group " << row.key;
+            });
+
+            EXPECT_EQ(stats.input_rows, kRows);
+            EXPECT_EQ(stats.output_rows, expected.size());
+            EXPECT_EQ(stats.partitions, 8u);
+            EXPECT_GT(stats.spilled_pages, 0u);
+            ASSERT_EQ(result.size(), expected.size());
+            for (const auto& [key, row] : expected) {
+                const AggregateRow& got = result.at(key);
+                EXPECT_EQ(got.count, row.count);
+                EXPECT_EQ(got.sum, row.sum);
+                EXPECT_EQ(got.min, row.min);
+                EXPECT_EQ(got.max, row.max);
+            }
+            // spill 페이지는 모두 임시 페이지 풀로 반납됨
+            const TempPagePool& temp_pages = disk_manager.get_temp_pages();
+            EXPECT_EQ(temp_pages.GetNumFreePages(), temp_pages.GetNumPages());
+            EXPECT_GT(temp_pages.GetNumPages(), 0u);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("hash_agg_test.fsm");
+    }
+
+    // 중복 키가 있는 양쪽을 spill하면서 조인해도 모든 쌍이 정확히 한 번씩 나옴
+    TEST(ExecutionTest, HashJoinTest) {
+        const std::string db_name = "hash_join_test.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(16, &disk_manager);
+
+            // build: 키 0..1999가 두 번씩, probe: 키 0..5999 (1/3만 매칭)
+            constexpr size_t kBuildRows = 4000;
+            constexpr size_t kProbeRows = 12000;
+            auto make_build = [](size_t i) { return Row{static_cast<int64_t>(i % 2000), static_cast<int64_t>(i)}; };
+            auto make_probe = [](size_t i) { return Row{static_cast<int64_t>(i % 6000), -static_cast<int64_t>(i)}; };
+            std::vector<PageId> build_pages = ParallelScan::CollectPages(&bpm, LoadRows(&bpm, kBuildRows, make_build));
+            std::vector<PageId> probe_pages = ParallelScan::CollectPages(&bpm, LoadRows(&bpm, kProbeRows, make_probe));
+
+            std::multimap<int64_t, int64_t> build_map;
+            for (size_t i = 0; i < kBuildRows; i++) {
+                build_map.emplace(make_build(i).key, make_build(i).value);
+            }
+            std::map<std::pair<int64_t, int64_t>, int> expected;
+            for (size_t i = 0; i < kProbeRows; i++) {
+                Row probe = make_probe(i);
+                auto [first, last] = build_map.equal_range(probe.key);
+                for (auto it = first; it != last; ++it) {
+                    expected[{it->second, probe.value}]++;
+                }
+            }
+
+            HashOperatorOptions options;
+            options.memory_limit = 32 * 1024;
+            HashJoin join(&bpm, options);
+
+            std::map<std::pair<int64_t, int64_t>, int> result;
+            HashOperatorStats stats = join.Execute(build_pages, KeyValueColumns{}, probe_pages, KeyValueColumns{},
+                [&](int64_t key, int64_t build_value, int64_t probe_value) {
+                    EXPECT_EQ(key, build_value % 2000);
+                    result[{build_value, probe_value}]++;
+                });
+
+            EXPECT_EQ(stats.input_rows, kBuildRows + kProbeRows);
+            EXPECT_EQ(stats.output_rows, 8000u);
+            EXPECT_GT(stats.spilled_pages, 0u);
+            EXPECT_EQ(result, expected);
+            const TempPagePool& temp_pages = disk_manager.get_temp_pages();
+            EXPECT_EQ(temp_pages.GetNumFreePages(), temp_pages.GetNumPages());
+            EXPECT_GT(temp_pages.GetNumPages(), 0u);
+
+            // 컬럼 위치가 튜플 밖이면 거부
+            KeyValueColumns bad_columns{0, 16};
+            EXPECT_THROW(join.Execute(build_pages, bad_columns, probe_pages, KeyValueColumns{},
+                                      [](int64_t, int64_t, int64_t) {}),
+                         std::runtime_error);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("hash_join_test.fsm");
+    }
+
+    // run이 fan-in보다 많아 중간 병합을 거쳐도 결과가 정렬되어 있고 모든 행이 한 번씩 나오며, 임시 페이지는 모두 반납됨
+    TEST(ExecutionTest, ExternalSortTest) {
+        const std::string db_name = "external_sort_test.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(16, &disk_manager);
+
+            // 음수 키와 중복 키 포함, payload = 행 번호
+            constexpr size_t kRows = 30000;
+            auto make_row = [](size_t i) {
+                return Row{static_cast<int64_t>((i * 7919) % 10007) - 5000, static_cast<int64_t>(i)};
+            };
+            std::vector<PageId> pages = ParallelScan::CollectPages(&bpm, LoadRows(&bpm, kRows, make_row));
+            std::vector<Row> expected;
+            for (size_t i = 0; i < kRows; i++) {
+                expected.push_back(make_row(i));
+            }
+            std::sort(expected.begin(), expected.end(), [](const Row& a, const Row& b) {
+                return a.key != b.key ? a.key < b.key : a.value < b.value;
+            });
+
+            for (bool prefetch : {true, false}) {
+                ExternalSortOptions options;
+                options.memory_limit = 64 * 1024; // 레코드 24 + 항목 16 -> run 하나에 1638행
+                options.max_fan_in = 3;
+                options.prefetch = prefetch;
+                ExternalSort sort(&bpm, options);
+
+                std::vector<Row> result;
+                ExternalSortStats stats = sort.Execute(pages, SortColumns{}, [&](const char* key, const char* payload) {
+                    Row row;
+                    std::memcpy(&row.key, key, sizeof(row.key));
+                    std::memcpy(&row.value, payload, sizeof(row.value));
+                    result.push_back(row);
+                });
+
+                EXPECT_EQ(stats.input_rows, kRows);
+                EXPECT_EQ(stats.runs, (kRows + 1637) / 1638);
+                EXPECT_GT(stats.merge_passes, 0u);
+                EXPECT_GT(stats.spilled_pages, 0u);
+                ASSERT_EQ(result.size(), kRows);
+                EXPECT_TRUE(std::is_sorted(result.begin(), result.end(), [](const Row& a, const Row& b) {
+                    return a.key < b.key;
+                }));
+                // 같은 키 안의 순서는 정해져 있지 않으므로 (키, payload)로 다시 정렬해서 비교
+                std::sort(result.begin(), result.end(), [](const Row& a, const Row& b) {
+                    return a.key != b.key ? a.key < b.key : a.value < b.value;
+                });
+                for (size_t i = 0; i < kRows; i++) {
+                    ASSERT_EQ(result[i].key, expected[i].key) << "row " << i;
+                    ASSERT_EQ(result[i].value, expected[i].value) << "row " << i;
+                }
+                // 테이블 페이지 외에는 모두 임시 페이지이고, 전부 풀로 반납됨
+                const TempPagePool& temp_pages = disk_manager.get_temp_pages();
+                EXPECT_EQ(temp_pages.GetNumPages(), disk_manager.GetNumPages() - pages.size());
+                EXPECT_EQ(temp_pages.GetNumFreePages(), temp_pages.GetNumPages());
+            }
+
+            // 메모리에 다 들어가면 임시 페이지를 쓰지 않음
+            ExternalSort in_memory(&bpm);
+            size_t count = 0;
+            ExternalSortStats stats = in_memory.Execute(pages, SortColumns{}, [&](const char*, const char*) { count++; });
+            EXPECT_EQ(count, kRows);
+            EXPECT_EQ(stats.runs, 1u);
+            EXPECT_EQ(stats.spilled_pages, 0u);
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("external_sort_test.fsm");
+    }
+
+    // 8바이트보다 긴 BYTES 키 내림차순: prefix가 같은 키는 나머지 바이트로 순서가 정해짐
+    TEST(ExecutionTest, ExternalSortBytesKeyTest) {
+        const std::string db_name = "external_sort_bytes_test.db";
+        std::filesystem::remove(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(16, &disk_manager);
+
+            // 키 12바이트: 앞 8바이트는 모든 행이 같은 "prefix__", 뒤 4바이트만 다름
+            struct WideRow {
+                char key[12];
+                int32_t value;
+            };
+            constexpr size_t kRows = 5000;
+            auto make_row = [](size_t i) {
+                WideRow row;
+                std::memcpy(row.key, "prefix__", 8);
+                auto suffix = static_cast<uint32_t>((i * 2654435761ULL) % 100000);
+                for (int b = 0; b < 4; b++) {
+                    row.key[8 + b] = static_cast<char>(suffix >> (24 - 8 * b)); // big-endian -> memcmp 순서 = 숫자 순서
+                }
+                row.value = static_cast<int32_t>(i);
+                return row;
+            };
+            std::vector<PageId> pages = ParallelScan::CollectPages(&bpm, LoadRows(&bpm, kRows, make_row));
+
+            SortColumns columns;
+            columns.key_type = SortKeyType::BYTES;
+            columns.key_length = sizeof(WideRow::key);
+            columns.descending = true;
+            columns.payload_offset = offsetof(WideRow, value);
+            columns.payload_length = sizeof(WideRow::value);
+
+            ExternalSortOptions options;
+            options.memory_limit = 16 * 1024;
+            ExternalSort sort(&bpm, options);
+
+            std::vector<std::string> keys;
+            std::vector<int32_t> values;
+            ExternalSortStats stats = sort.Execute(pages, columns, [&](const char* key, const char* payload) {
+                keys.emplace_back(key, sizeof(WideRow::key));
+                int32_t value;
+                std::memcpy(&value, payload, sizeof(value));
+                values.push_back(value);
+            });
+
+            EXPECT_GT(stats.runs, 1u);
+            ASSERT_EQ(keys.size(), kRows);
+            EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end(), std::greater<>()));
+            for (size_t i = 0; i < kRows; i++) {
+                WideRow row = make_row(static_cast<size_t>(values[i]));
+                ASSERT_EQ(keys[i], std::string(row.key, sizeof(row.key))) << "row " << i;
+            }
+            std::sort(values.begin(), values.end());
+            for (size_t i = 0; i < kRows; i++) {
+                ASSERT_EQ(values[i], static_cast<int32_t>(i));
+            }
+        }
+        std::filesystem::remove(db_name);
+        std::filesystem::remove("external_sort_bytes_test.fsm");
+    }
+    // 반납하기 전에 크래시가 나도 임시 페이지는 다음 시작 때 free list로 돌아감 (정상 종료도 마찬가지)
+    TEST(ExecutionTest, TempPagesReclaimedAfterCrashTest) {
+        const std::string db_name = "temp_crash_test.db";
+        const std::string crash_name = "temp_crash_test_copy.db";
+        auto cleanup = [&] {
+            for (const std::string& name : {db_name, crash_name}) {
+                for (const char* ext : {".db", ".fsm", ".spill"}) {
+                    std::filesystem::remove(std::filesystem::path(name).replace_extension(ext));
+                }
+            }
+        };
+        cleanup();
+
+        size_t num_temp_pages;
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(4, &disk_manager);
+            PageId table_page_id;
+            ASSERT_NE(bpm.NewPage(&table_page_id), nullptr);
+            bpm.UnpinPage(table_page_id, true);
+
+            // 풀보다 큰 run: 쓰는 도중 임시 페이지가 쫓겨나며 디스크에 쓰임
+            TempRunWriter writer(&bpm, sizeof(Row));
+            size_t num_rows = TempPageLayout::RecordsPerPage(sizeof(Row)) * 10;
+            for (size_t i = 0; i < num_rows; i++) {
+                Row row{static_cast<int64_t>(i), 0};
+                writer.Append(&row);
+            }
+            TempRun run = writer.Finish();
+            ASSERT_EQ(run.pages.size(), 10u);
+
+            // 정상 경로에서는 임시 페이지를 일반 DeletePage로 지울 수 없음
+            EXPECT_FALSE(bpm.DeletePage(run.pages.front()));
+
+            // run을 반납하기 전의 파일 상태 = 크래시 직후
+            bpm.FlushAllPages();
+            num_temp_pages = disk_manager.get_temp_pages().GetNumPages();
+            ASSERT_GE(num_temp_pages, run.pages.size());
+            std::filesystem::copy_file(db_name, crash_name);
+            std::filesystem::copy_file("temp_crash_test.spill", "temp_crash_test_copy.spill");
+
+            FreeTempRun(&bpm, &run);
+        }
+        EXPECT_FALSE(std::filesystem::exists("temp_crash_test.spill"));
+
+        // 정상 종료: 임시 페이지는 .fsm의 free list로
+        {
+            DiskManager disk_manager(db_name);
+            EXPECT_EQ(disk_manager.get_temp_pages().get_num_reclaimed(), 0u);
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), num_temp_pages);
+        }
+
+        // 크래시 (.fsm 없음, .spill 남음): .spill에 적힌 페이지를 free list로 돌려주고 파일을 지움
+        {
+            DiskManager disk_manager(crash_name);
+            EXPECT_EQ(disk_manager.get_temp_pages().get_num_reclaimed(), num_temp_pages);
+            EXPECT_EQ(disk_manager.get_allocator().GetNumFreePages(), num_temp_pages);
+            EXPECT_FALSE(disk_manager.get_allocator().IsFree(0)); // 테이블 페이지는 그대로
+            EXPECT_FALSE(std::filesystem::exists("temp_crash_test_copy.spill"));
+        }
+
+        cleanup();
+    }
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/buffer/MetricsReporter.hpp"
+#include "mydb/common/Metrics.hpp"
+
+namespace mydb {
+
+    // 샤드 카운터 합계, 히스토그램 버킷 경계와 백분위
+    TEST(MetricsTest, CounterAndHistogramTest) {
+        ShardedCounter counter;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < 1000; i++) {
+                    counter.Add();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(counter.Load(), 4000);
+
+        // 버킷 상한은 값 이상이고, 상대 오차는 1/16 이하
+        for (uint64_t value : {0ULL, 1ULL, 15ULL, 16ULL, 17ULL, 1000ULL, 123456ULL, 1ULL << 39}) {
+            uint64_t upper = LatencyHistogram::BucketUpperBound(LatencyHistogram::BucketIndex(value));
+            EXPECT_GE(upper, value);
+            EXPECT_LE(upper - value, value / LatencyHistogram::SUB_BUCKETS);
+        }
+        EXPECT_EQ(LatencyHistogram::BucketIndex(UINT64_MAX), LatencyHistogram::NUM_BUCKETS - 1);
+
+        LatencyHistogram histogram;
+        for (uint64_t i = 1; i <= 1000; i++) {
+            histogram.Record(i * 1000); // 1us ~ 1ms
+        }
+        HistogramSnapshot snapshot = histogram.Snapshot();
+        EXPECT_EQ(snapshot.count, 1000);
+        EXPECT_DOUBLE_EQ(snapshot.Mean(), 500500.0);
+        EXPECT_NEAR(static_cast<double>(snapshot.Percentile(50)), 500000.0, 500000.0 / 16);
+        EXPECT_NEAR(static_cast<double>(snapshot.Percentile(99)), 990000.0, 990000.0 / 16);
+        EXPECT_GE(snapshot.Max(), 1000000);
+
+        histogram.Record(5);
+        HistogramSnapshot diff = histogram.Snapshot().Since(snapshot);
+        EXPECT_EQ(diff.count, 1);
+        EXPECT_EQ(diff.Max(), 5);
+    }
+
+    // FetchPage hit/miss, eviction, dirty write-back, 디스크 I/O 횟수가 버퍼 풀 동작과 맞아야 함
+    TEST(MetricsTest, BufferPoolMetricsTest) {
+        const std::string db_name = "metrics_test.db";
+        std::filesystem::remove(db_name);
+
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(2, &disk_manager);
+
+            PageId page_ids[3];
+            for (auto& page_id : page_ids) {
+                ASSERT_NE(bpm.NewPage(&page_id), nullptr);
+                bpm.UnpinPage(page_id, true);
+            }
+            // 3번째 NewPage에서 첫 페이지(dirty)가 쫓겨남
+
+            ASSERT_NE(bpm.FetchPage(page_ids[2]), nullptr); // hit
+            bpm.UnpinPage(page_ids[2], false);
+            ASSERT_NE(bpm.FetchPage(page_ids[0]), nullptr); // miss, 두 번째 페이지(dirty)가 쫓겨남
+            bpm.UnpinPage(page_ids[0], false);
+
+            BufferPoolMetricsSnapshot snapshot = bpm.GetMetricsSnapshot();
+            EXPECT_EQ(snapshot.new_pages, 3);
+            EXPECT_EQ(snapshot.fetch_hits, 1);
+            EXPECT_EQ(snapshot.fetch_misses, 1);
+            EXPECT_DOUBLE_EQ(snapshot.HitRatio(), 0.5);
+            EXPECT_EQ(snapshot.evictions, 2);
+            EXPECT_EQ(snapshot.dirty_writebacks, 2);
+            EXPECT_EQ(snapshot.pages_read, 1);
+            EXPECT_EQ(snapshot.pages_written, 2);
+            EXPECT_EQ(snapshot.read_latency.count, 1);
+            EXPECT_EQ(snapshot.write_latency.count, 2);
+            EXPECT_GE(snapshot.lock_acquisitions, 8);
+
+            // 일괄 읽기는 페이지당 지연(read_latency)에 섞지 않고 따로 기록
+            std::vector<char> buffer(2 * PAGE_SIZE);
+            ASSERT_EQ(disk_manager.ReadPages(page_ids[0], 2, buffer.data()), 2u);
+            BufferPoolMetricsSnapshot batch = bpm.GetMetricsSnapshot().Since(snapshot);
+            EXPECT_EQ(batch.pages_read, 2);
+            EXPECT_EQ(batch.read_latency.count, 0);
+            EXPECT_EQ(batch.batch_read_latency.count, 1);
+
+            // 리포트는 직전 리포트 이후 구간만 기록
+            MetricsReporter reporter(&bpm);
+            ASSERT_NE(bpm.FetchPage(page_ids[0]), nullptr);
+            bpm.UnpinPage(page_ids[0], false);
+            std::string line = reporter.Report();
+            EXPECT_NE(line.find("hit 100.0%"), std::string::npos);
+        }
+
+        std::filesystem::remove(db_name);
+    }
+}
@@ -0,0 +1,382 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mydb/buffer/BufferPoolManager.hpp"
+#include "mydb/recovery/Checkpointer.hpp"
+#include "mydb/recovery/LogManager.hpp"
+#include "mydb/recovery/LogRecovery.hpp"
+#include "mydb/storage/TablePage.hpp"
+
+namespace mydb {
+
+    namespace {
+        void RemoveDbFiles(const std::string& db_name) {
+            std::filesystem::remove(db_name);
+            std::filesystem::remove(std::filesystem::path(db_name).replace_extension(".log"));
+        }
+    }
+
+    // 직렬화 -> 역직렬화 결과가 같아야 하고, 1바이트라도 깨지면 거부해야 함
+    TEST(RecoveryTest, LogRecordSerializeTest) {
+        char data[] = "log me";
+        LogRecord record = LogRecord::MakeInsert(7, 3, Tuple(data, sizeof(data)));
+        record.lsn_ = 100;
+        record.prev_lsn_ = 50;
+        record.txn_id_ = 9;
+
+        std::vector<char> buf(record.size_);
+        record.SerializeTo(buf.data());
+
+        LogRecord result;
+        ASSERT_TRUE(LogRecord::Deserialize(buf.data(), buf.size(), &result));
+        EXPECT_EQ(result.type_, LogRecordType::INSERT);
+        EXPECT_EQ(result.lsn_, 100);
+        EXPECT_EQ(result.prev_lsn_, 50);
+        EXPECT_EQ(result.txn_id_, 9);
+        EXPECT_EQ(result.page_id_, 7);
+        EXPECT_EQ(result.slot_id_, 3);
+        EXPECT_EQ(std::memcmp(result.tuple_.GetData(), data, sizeof(data)), 0);
+
+        // 잘린 레코드, 손상된 레코드
+        EXPECT_FALSE(LogRecord::Deserialize(buf.data(), buf.size() - 1, &result));
+        buf[LogRecord::HEADER_SIZE + 1] ^= 0x1;
+        EXPECT_FALSE(LogRecord::Deserialize(buf.data(), buf.size(), &result));
+    }
+
+    // dirty 페이지가 쫓겨날 때, 그 페이지의 LSN까지 로그가 먼저 디스크에 있어야 함
+    TEST(RecoveryTest, WalBeforeDataTest) {
+        const std::string db_name = "wal_test.db";
+        RemoveDbFiles(db_name);
+
+        {
+            DiskManager disk_manager(db_name);
+            // flush 주기를 길게 잡아서, eviction이 직접 flush를 요청하는지 확인
+            LogManager log_manager(&disk_manager, LOG_BUFFER_SIZE, std::chrono::seconds(10));
+            BufferPoolManager bpm(1, &disk_manager, &log_manager);
+
+            Transaction txn = log_manager.Begin();
+
+            PageId page_id;
+            auto* page = reinterpret_cast<TablePage*>(bpm.NewPage(&page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, &txn, &log_manager);
+
+            char data[] = "not committed yet";
+            uint16_t slot_id;
+            ASSERT_TRUE(page->InsertTuple(Tuple(data, sizeof(data)), &slot_id, &txn, &log_manager));
+            Lsn page_lsn = page->get_lsn();
+            EXPECT_GE(page_lsn, log_manager.GetPersistentLsn());
+            bpm.UnpinPage(page_id, true);
+
+            // 프레임이 1개뿐이므로 새 페이지를 만들면 위 페이지가 쫓겨남
+            PageId other_page_id;
+            ASSERT_NE(bpm.NewPage(&other_page_id), nullptr);
+            EXPECT_GT(log_manager.GetPersistentLsn(), page_lsn);
+            bpm.UnpinPage(other_page_id, false);
+        }
+
+        RemoveDbFiles(db_name);
+    }
+
+    // 커밋된 변경은 redo로 살아나고, 커밋 안 된 변경은 undo로 사라져야 함
+    TEST(RecoveryTest, RedoUndoTest) {
+        const std::string db_name = "recovery_test.db";
+        RemoveDbFiles(db_name);
+
+        char committed[] = "committed tuple";
+        char uncommitted[] = "uncommitted tuple";
+        PageId page_id;
+        uint16_t committed_slot, uncommitted_slot, deleted_slot;
+
+        // 1. 크래시 전: 페이지는 디스크에 쓰지 않고(= 버퍼 풀 내용 유실) 종료
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            Transaction txn1 = log_manager.Begin();
+            auto* page = reinterpret_cast<TablePage*>(bpm.NewPage(&page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, &txn1, &log_manager);
+            ASSERT_TRUE(page->InsertTuple(Tuple(committed, sizeof(committed)), &committed_slot, &txn1, &log_manager));
+            ASSERT_TRUE(page->InsertTuple(Tuple(committed, sizeof(committed)), &deleted_slot, &txn1, &log_manager));
+            log_manager.Commit(&txn1);
+
+            // txn2: 커밋 전에 크래시
+            Transaction txn2 = log_manager.Begin();
+            ASSERT_TRUE(page->InsertTuple(Tuple(uncommitted, sizeof(uncommitted)), &uncommitted_slot, &txn2, &log_manager));
+            ASSERT_TRUE(page->MarkDelete(deleted_slot, &txn2, &log_manager));
+            bpm.UnpinPage(page_id, true);
+
+            // 커밋 안 된 변경이 반영된 페이지가 디스크에 쓰인 상황을 만듦 (undo 대상)
+            ASSERT_TRUE(bpm.FlushPage(page_id));
+        }
+
+        // 2. 재시작 + 복구
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            LogRecovery recovery(&disk_manager, &bpm, &log_manager);
+            recovery.Recover();
+            EXPECT_EQ(recovery.get_num_undone_txns(), 1);
+
+            auto* page = reinterpret_cast<TablePage*>(bpm.FetchPage(page_id));
+            ASSERT_NE(page, nullptr);
+
+            Tuple tuple;
+            ASSERT_TRUE(page->GetTuple(committed_slot, &tuple));
+            EXPECT_EQ(std::memcmp(tuple.GetData(), committed, sizeof(committed)), 0);
+
+            // txn2의 삽입은 사라지고, 삭제는 되돌려져야 함
+            EXPECT_FALSE(page->GetTuple(uncommitted_slot, &tuple));
+            ASSERT_TRUE(page->GetTuple(deleted_slot, &tuple));
+            EXPECT_EQ(std::memcmp(tuple.GetData(), committed, sizeof(committed)), 0);
+
+            bpm.UnpinPage(page_id, false);
+        }
+
+        // 3. 한 번 더 재시작: 이미 undo된 트랜잭션은 다시 undo하지 않아야 함 (CLR, ABORT 기록)
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            LogRecovery recovery(&disk_manager, &bpm, &log_manager);
+            recovery.Recover();
+            EXPECT_EQ(recovery.get_num_undone_txns(), 0);
+
+            auto* page = reinterpret_cast<TablePage*>(bpm.FetchPage(page_id));
+            ASSERT_NE(page, nullptr);
+            Tuple tuple;
+            EXPECT_TRUE(page->GetTuple(committed_slot, &tuple));
+            EXPECT_TRUE(page->GetTuple(deleted_slot, &tuple));
+            EXPECT_FALSE(page->GetTuple(uncommitted_slot, &tuple));
+            bpm.UnpinPage(page_id, false);
+        }
+
+        RemoveDbFiles(db_name);
+    }
+
+    // 체크포인트 이후에 크래시 나면, 복구는 체크포인트 이후부터 redo해야 하고
+    // 체크포인트를 걸쳐 진행 중이던 트랜잭션은 undo되어야 함
+    TEST(RecoveryTest, CheckpointTest) {
+        const std::string db_name = "checkpoint_test.db";
+        RemoveDbFiles(db_name);
+
+        char before[] = "before checkpoint";
+        char after[] = "after checkpoint";
+        char loser[] = "spans checkpoint";
+        PageId page_id;
+        uint16_t before_slot, after_slot, loser_slot;
+        Lsn checkpoint_lsn;
+
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            Transaction txn1 = log_manager.Begin();
+            auto* page = reinterpret_cast<TablePage*>(bpm.NewPage(&page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, &txn1, &log_manager);
+            ASSERT_TRUE(page->InsertTuple(Tuple(before, sizeof(before)), &before_slot, &txn1, &log_manager));
+            log_manager.Commit(&txn1);
+
+            // 커밋 안 된 트랜잭션이 체크포인트를 걸쳐 있음
+            Transaction txn2 = log_manager.Begin();
+            ASSERT_TRUE(page->InsertTuple(Tuple(loser, sizeof(loser)), &loser_slot, &txn2, &log_manager));
+            bpm.UnpinPage(page_id, true);
+
+            Checkpointer checkpointer(&bpm, &log_manager);
+            CheckpointStats stats = checkpointer.Checkpoint();
+            checkpoint_lsn = stats.checkpoint_lsn;
+            EXPECT_EQ(stats.pages_written, 1);
+            EXPECT_EQ(log_manager.GetCheckpointLsn(), checkpoint_lsn);
+
+            // 체크포인트에서 썼으니 더 이상 dirty가 아님
+            EXPECT_TRUE(bpm.GetDirtyPageTable().empty());
+
+            Transaction txn3 = log_manager.Begin();
+            page = reinterpret_cast<TablePage*>(bpm.FetchPage(page_id));
+            ASSERT_NE(page, nullptr);
+            ASSERT_TRUE(page->InsertTuple(Tuple(after, sizeof(after)), &after_slot, &txn3, &log_manager));
+            bpm.UnpinPage(page_id, true);
+            log_manager.Commit(&txn3);
+
+            // DPT에는 체크포인트 이후 수정된 페이지가 다시 잡혀야 함
+            auto dirty_pages = bpm.GetDirtyPageTable();
+            ASSERT_EQ(dirty_pages.size(), 1);
+            EXPECT_GT(dirty_pages[0].second, checkpoint_lsn);
+        }
+
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            LogRecovery recovery(&disk_manager, &bpm, &log_manager);
+            recovery.Recover();
+
+            EXPECT_GE(recovery.get_redo_start_lsn(), checkpoint_lsn);
+            EXPECT_EQ(recovery.get_num_undone_txns(), 1);
+
+            auto* page = reinterpret_cast<TablePage*>(bpm.FetchPage(page_id));
+            ASSERT_NE(page, nullptr);
+
+            Tuple tuple;
+            ASSERT_TRUE(page->GetTuple(before_slot, &tuple));
+            EXPECT_EQ(std::memcmp(tuple.GetData(), before, sizeof(before)), 0);
+            ASSERT_TRUE(page->GetTuple(after_slot, &tuple));
+            EXPECT_EQ(std::memcmp(tuple.GetData(), after, sizeof(after)), 0);
+            EXPECT_FALSE(page->GetTuple(loser_slot, &tuple));
+
+            bpm.UnpinPage(page_id, false);
+        }
+
+        RemoveDbFiles(db_name);
+    }
+    // 같은 슬롯을 건드린 loser들은 기록된 역순(LSN 내림차순)으로 되돌려져야 함:
+    // A가 삽입한 튜플을 B가 삭제했다면, B의 삭제를 먼저 되돌리고 A의 삽입을 나중에 되돌려야 튜플이 사라짐
+    TEST(RecoveryTest, InterleavedLosersUndoTest) {
+        const std::string db_name = "interleaved_undo_test.db";
+        RemoveDbFiles(db_name);
+
+        constexpr int kPairs = 4;
+        char data[] = "inserted by one loser, deleted by another";
+        PageId page_id;
+        uint16_t slots[kPairs];
+
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            Transaction setup = log_manager.Begin();
+            auto* page = reinterpret_cast<TablePage*>(bpm.NewPage(&page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, &setup, &log_manager);
+            log_manager.Commit(&setup);
+
+            // 트랜잭션 ID 순서와 무관하게 맞아야 하므로, 짝마다 삽입/삭제 쪽 ID 순서를 바꿔 가며 만듦
+            std::vector<Transaction> txns;
+            for (int i = 0; i < 2 * kPairs; i++) {
+                txns.push_back(log_manager.Begin());
+            }
+            for (int i = 0; i < kPairs; i++) {
+                Transaction& inserter = txns[i % 2 == 0 ? 2 * i : 2 * i + 1];
+                Transaction& deleter = txns[i % 2 == 0 ? 2 * i + 1 : 2 * i];
+                ASSERT_TRUE(page->InsertTuple(Tuple(data, sizeof(data)), &slots[i], &inserter, &log_manager));
+                ASSERT_TRUE(page->MarkDelete(slots[i], &deleter, &log_manager));
+            }
+            bpm.UnpinPage(page_id, true);
+            ASSERT_TRUE(bpm.FlushPage(page_id));
+            log_manager.FlushAll();
+        }
+
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            LogRecovery recovery(&disk_manager, &bpm, &log_manager);
+            recovery.Recover();
+            EXPECT_EQ(recovery.get_num_undone_txns(), 2 * kPairs);
+
+            auto* page = reinterpret_cast<TablePage*>(bpm.FetchPage(page_id));
+            ASSERT_NE(page, nullptr);
+            Tuple tuple;
+            for (int i = 0; i < kPairs; i++) {
+                EXPECT_FALSE(page->GetTuple(slots[i], &tuple)) << "slot " << slots[i];
+            }
+            bpm.UnpinPage(page_id, false);
+        }
+
+        RemoveDbFiles(db_name);
+    }
+    // redo한 INSERT가 로그에 기록된 슬롯에 들어가지 못하면 복구를 중단해야 함 (이후 레코드가 그 슬롯 번호를 가리키므로)
+    TEST(RecoveryTest, RedoSlotMismatchTest) {
+        const std::string db_name = "redo_mismatch_test.db";
+        RemoveDbFiles(db_name);
+
+        char data[] = "logged tuple";
+        char stray[] = "not in the log";
+        PageId page_id;
+        Lsn init_lsn;
+
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            Transaction txn = log_manager.Begin();
+            auto* page = reinterpret_cast<TablePage*>(bpm.NewPage(&page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, &txn, &log_manager);
+            init_lsn = page->get_lsn();
+            uint16_t slot_id;
+            ASSERT_TRUE(page->InsertTuple(Tuple(data, sizeof(data)), &slot_id, &txn, &log_manager));
+            EXPECT_EQ(slot_id, 0);
+            bpm.UnpinPage(page_id, true);
+            log_manager.Commit(&txn);
+        }
+
+        // 디스크의 페이지에 로그에 없는 튜플이 0번 슬롯을 차지한 상태를 만듦 (INIT_PAGE는 이미 반영된 것으로 보이게)
+        {
+            DiskManager disk_manager(db_name);
+            BufferPoolManager bpm(4, &disk_manager);
+            auto* page = reinterpret_cast<TablePage*>(bpm.FetchPage(page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id);
+            uint16_t slot_id;
+            ASSERT_TRUE(page->InsertTuple(Tuple(stray, sizeof(stray)), &slot_id));
+            page->set_lsn(init_lsn);
+            bpm.UnpinPage(page_id, true);
+            ASSERT_TRUE(bpm.FlushPage(page_id));
+        }
+
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            LogRecovery recovery(&disk_manager, &bpm, &log_manager);
+            EXPECT_THROW(recovery.Recover(), std::runtime_error);
+        }
+
+        RemoveDbFiles(db_name);
+    }
+    // txn 없이 log_manager만 넘기면 로그를 남기지 않음 (페이지 LSN도 그대로)
+    TEST(RecoveryTest, NoTxnSkipsLoggingTest) {
+        const std::string db_name = "no_txn_log_test.db";
+        RemoveDbFiles(db_name);
+        {
+            DiskManager disk_manager(db_name);
+            LogManager log_manager(&disk_manager);
+            BufferPoolManager bpm(4, &disk_manager, &log_manager);
+
+            log_manager.FlushAll();
+            Lsn persistent_lsn = log_manager.GetPersistentLsn();
+
+            PageId page_id;
+            auto* page = reinterpret_cast<TablePage*>(bpm.NewPage(&page_id));
+            ASSERT_NE(page, nullptr);
+            page->Init(page_id, INVALID_PAGE_ID, INVALID_PAGE_ID, nullptr, &log_manager);
+            char data[] = "unlogged";
+            uint16_t slot_id;
+            ASSERT_TRUE(page->InsertTuple(Tuple(data, sizeof(data)), &slot_id, nullptr, &log_manager));
+            ASSERT_TRUE(page->MarkDelete(slot_id, nullptr, &log_manager));
+            EXPECT_EQ(page->get_lsn(), INVALID_LSN);
+            bpm.UnpinPage(page_id, true);
+
+            log_manager.FlushAll();
+            EXPECT_EQ(log_manager.GetPersistentLsn(), persistent_lsn);
+        }
+        RemoveDbFiles(db_name);
+    }
+}
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <vector>
+
 #include "mydb/storage/TablePage.hpp"
 
 namespace mydb {
@@ -27,7 +29,7 @@ namespace mydb {
         Slot* slots = page.GetSlotArray();
         EXPECT_EQ(slots[0].length_, sizeof(raw_data));
         // 현재 offset위치 검증
-        EXPECT_EQ(slots[0].offset_, PAGE_SIZE - sizeof(raw_data));
+        EXPECT_EQ(slots[0].offset_, PAGE_TRAILER_OFFSET - sizeof(raw_data));
 
         // 3. 실제로 데이터가 해당 위치에 있는지?
         char* data_ptr = page.get_data() + slots[0].offset_;
@@ -44,7 +46,7 @@ namespace mydb {
         EXPECT_EQ(slot_id, 1);
         EXPECT_EQ(page.GetHeader()->num_slots_, 2);
 
-        EXPECT_EQ(slots[1].offset_, PAGE_SIZE - sizeof(raw_data) - sizeof(raw_data2));
+        EXPECT_EQ(slots[1].offset_, PAGE_TRAILER_OFFSET - sizeof(raw_data) - sizeof(raw_data2));
 
         data_ptr = page.get_data() + slots[1].offset_;
         EXPECT_EQ(std::memcmp(data_ptr, raw_data2, sizeof(raw_data2)), 0);
@@ -92,4 +94,68 @@ namespace mydb {
         // 6. 삭제된걸 다시 삭제 시도 시, 실패
         EXPECT_FALSE(page.MarkDelete(slot2));
     }
+
+    // 짧은 행은 inline, 긴 행은 힙/arena. 같은 Tuple로 다시 읽으면 버퍼 재사용, arena는 Reset 후 블록 재사용
+    TEST(TablePageTest, TupleStorageTest) {
+        std::vector<char> small(16, 's');
+        std::vector<char> large(200, 'l');
+
+        Tuple inline_tuple(small.data(), static_cast<uint32_t>(small.size()));
+        EXPECT_TRUE(inline_tuple.is_inline());
+        Tuple heap_tuple(large.data(), static_cast<uint32_t>(large.size()));
+        EXPECT_FALSE(heap_tuple.is_inline());
+
+        // 복사/이동 후에도 내용이 같고, 이동된 쪽은 비어 있음
+        Tuple copied = heap_tuple;
+        EXPECT_NE(copied.GetData(), heap_tuple.GetData());
+        EXPECT_EQ(std::memcmp(copied.GetData(), large.data(), large.size()), 0);
+        const char* heap_data = heap_tuple.GetData();
+        Tuple moved = std::move(heap_tuple);
+        EXPECT_EQ(moved.GetData(), heap_data);
+        EXPECT_EQ(heap_tuple.GetSize(), 0u);
+        Tuple moved_inline = std::move(inline_tuple);
+        EXPECT_TRUE(moved_inline.is_inline());
+        EXPECT_EQ(std::memcmp(moved_inline.GetData(), small.data(), small.size()), 0);
+
+        TablePage page;
+        page.Init(100);
+        uint16_t small_slot, large_slot;
+        ASSERT_TRUE(page.InsertTuple(Tuple(small.data(), static_cast<uint32_t>(small.size())), &small_slot));
+        ASSERT_TRUE(page.InsertTuple(Tuple(large.data(), static_cast<uint32_t>(large.size())), &large_slot));
+
+        // 큰 행을 읽은 버퍼에 짧은 행을 읽어도 같은 버퍼를 씀
+        Tuple result;
+        ASSERT_TRUE(page.GetTuple(large_slot, &result));
+        const char* buffer = result.GetData();
+        ASSERT_TRUE(page.GetTuple(small_slot, &result));
+        EXPECT_EQ(result.GetData(), buffer);
+        EXPECT_EQ(std::memcmp(result.GetData(), small.data(), small.size()), 0);
+
+        // arena: 큰 행은 arena 메모리를 가리키고, 복사하면 독립적인 힙 튜플이 됨
+        TupleArena arena(4096);
+        std::vector<Tuple> rows(10);
+        for (auto& row : rows) {
+            ASSERT_TRUE(page.GetTuple(large_slot, &row, &arena));
+            EXPECT_EQ(std::memcmp(row.GetData(), large.data(), large.size()), 0);
+        }
+        EXPECT_EQ(arena.get_bytes_used(), rows.size() * 200);
+        EXPECT_EQ(arena.get_num_blocks(), 1u);
+        Tuple kept = rows[0];
+        rows.clear();
+
+        arena.Reset();
+        EXPECT_EQ(arena.get_bytes_used(), 0u);
+        for (int i = 0; i < 10; i++) {
+            Tuple row;
+            page.GetTuple(large_slot, &row, &arena);
+        }
+        EXPECT_EQ(arena.get_num_blocks(), 1u);
+        EXPECT_EQ(std::memcmp(kept.GetData(), large.data(), large.size()), 0);
+
+        // 블록의 1/4보다 큰 요청은 전용 블록
+        std::vector<char> huge(2000, 'h');
+        Tuple huge_tuple(huge.data(), static_cast<uint32_t>(huge.size()), &arena);
+        EXPECT_EQ(std::memcmp(huge_tuple.GetData(), huge.data(), huge.size()), 0);
+        EXPECT_EQ(arena.get_num_blocks(), 1u);
+    }
 }
\ No newline at end of file
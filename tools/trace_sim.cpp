@@ -0,0 +1,112 @@
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "mydb/buffer/ReplacementSimulator.hpp"
+
+/**
+ * BufferPoolManager::StartTrace로 기록한 트레이스를 교체 정책 x 풀 크기별로 재생해서 hit 비율 곡선을 출력
+ *
+ * 사용법: mydb_trace_sim <trace> [--policies lru,clock] [--pool-sizes 64,256,1024]
+ * --pool-sizes를 생략하면 64부터 트레이스에 나온 서로 다른 페이지 수까지 2배씩
+ */
+namespace {
+
+    void PrintUsage() {
+        std::fprintf(stderr, "usage: mydb_trace_sim <trace> [--policies lru,clock] [--pool-sizes 64,256,...]\n");
+    }
+
+    std::vector<std::string> Split(const std::string& s, char delimiter) {
+        std::vector<std::string> items;
+        std::stringstream ss(s);
+        std::string item;
+        while (std::getline(ss, item, delimiter)) {
+            if (!item.empty()) {
+                items.push_back(item);
+            }
+        }
+        return items;
+    }
+
+    // 기본 풀 크기: 트레이스의 서로 다른 페이지 수 (= 풀이 이만큼이면 cold miss만 남음)까지
+    std::vector<size_t> DefaultPoolSizes(const std::string& trace_path) {
+        std::unordered_set<mydb::PageId> pages;
+        mydb::TraceReader reader(trace_path);
+        mydb::TraceEvent event;
+        while (reader.Next(&event)) {
+            pages.insert(event.page_id_);
+        }
+
+        std::vector<size_t> sizes;
+        size_t size = 64;
+        for (; size < pages.size(); size *= 2) {
+            sizes.push_back(size);
+        }
+        sizes.push_back(std::max<size_t>(pages.size(), 1));
+        return sizes;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::string trace_path = argv[1];
+    std::vector<mydb::ReplacerType> policies = {mydb::ReplacerType::LRU, mydb::ReplacerType::CLOCK};
+    std::vector<size_t> pool_sizes;
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            PrintUsage();
+            return 1;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--policies") {
+            policies.clear();
+            for (const auto& name : Split(value, ',')) {
+                mydb::ReplacerType type;
+                if (!mydb::ParseReplacerType(name, &type)) {
+                    std::fprintf(stderr, "unknown policy: %s\n", name.c_str());
+                    return 1;
+                }
+                policies.push_back(type);
+            }
+        } else if (arg == "--pool-sizes") {
+            for (const auto& size : Split(value, ',')) {
+                pool_sizes.push_back(std::strtoull(size.c_str(), nullptr, 10));
+            }
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    try {
+        if (pool_sizes.empty()) {
+            pool_sizes = DefaultPoolSizes(trace_path);
+        }
+
+        auto results = mydb::ReplacementSimulator::Replay(trace_path, policies, pool_sizes);
+
+        std::printf("%-8s %10s %12s %12s %10s %12s %10s %8s\n",
+                    "policy", "pool_size", "fetches", "misses", "hit_ratio", "evictions", "writebacks", "stalls");
+        for (const auto& r : results) {
+            std::printf("%-8s %10zu %12lu %12lu %10.4f %12lu %10lu %8lu\n",
+                        mydb::ReplacerTypeName(r.policy), r.pool_size,
+                        static_cast<unsigned long>(r.fetches), static_cast<unsigned long>(r.misses), r.HitRatio(),
+                        static_cast<unsigned long>(r.evictions), static_cast<unsigned long>(r.dirty_writebacks),
+                        static_cast<unsigned long>(r.stalls));
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "error: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}